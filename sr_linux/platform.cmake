@@ -3,7 +3,7 @@
 # Copyright (c) 2013-2020 Fidelity National Information		#
 # Services, Inc. and/or its subsidiaries. All rights reserved.	#
 #								#
-# Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries.	#
+# Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	#
 # All rights reserved.						#
 #								#
 # Copyright (c) 2017-2018 Stephen L Johnson.			#
@@ -263,6 +263,8 @@ set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_next_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_next_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_previous_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_previous_st")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_many_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_many_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_sig_dispatch")
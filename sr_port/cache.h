@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -32,6 +35,7 @@ typedef struct cache_ent
 	icode_str	src;
 	int		refcnt;			/* Number of indirect source code pointing to same cache entry */
 	int		zb_refcnt;		/* Number of zbreak action entry pointing to same cache entry */
+	boolean_t	recently_used;		/* Set by cache_get on a hit; spares the entry from the next cold-entry eviction */
 } cache_entry;
 
 /* Following is the indirect routine header build as part of an indirect code object */
@@ -57,10 +61,17 @@ typedef struct ihead_struct
 #define MAX_INDRCACHE_KBSIZE		2048
 #define DEFAULT_INRDCACHE_ENTRIES	128
 
+/* Caller needs GBLREFs for cache_table, indir_cache_mem_size, max_cache_memsize and max_cache_entries */
+#define	CACHE_OVER_LIMIT	((indir_cache_mem_size > max_cache_memsize) || (cache_table.count > max_cache_entries))
+/* Eviction frees down to this low-water mark (3/4 of the limits) so the next few cache_put calls do not evict again */
+#define	CACHE_OVER_LOW_MARK	((indir_cache_mem_size > (max_cache_memsize / 4 * 3))				\
+					|| (cache_table.count > (max_cache_entries / 4 * 3)))
+
 void indir_lits(ihdtyp *ihead);
 void cache_init(void);
 mstr *cache_get(icode_str *indir_src);
 void cache_put(icode_str *src, mstr *object);
+void cache_table_evict(boolean_t cold_only);
 void cache_table_rebuild(void);
 void cache_stats(void);
 
@@ -2,7 +2,7 @@
  *								*
  *	Copyright 2001, 2004 Sanchez Computer Associates, Inc.	*
  *								*
- * Copyright (c) 2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2021-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -35,7 +35,9 @@ mstr *cache_get(icode_str *indir_src)
 	if (NULL != (tabent = lookup_hashtab_objcode(&cache_table, indir_src)))
 	{
 		cache_hits++;
-		return &(((cache_entry *)tabent->value)->obj);
+		csp = (cache_entry *)tabent->value;
+		csp->recently_used = TRUE;
+		return &csp->obj;
 	} else
 	{
 		cache_fails++;
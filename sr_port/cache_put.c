@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2011 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2018-2021 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -38,11 +38,12 @@ void cache_put(icode_str *src, mstr *object)
 	boolean_t	added;
 
 	indir_cache_mem_size += (ICACHE_SIZE + object->len);
-	if (indir_cache_mem_size > max_cache_memsize || cache_table.count > max_cache_entries)
-		cache_table_rebuild();
+	if (CACHE_OVER_LIMIT)
+		cache_table_evict(TRUE);
 	csp = (cache_entry *)GTM_TEXT_ALLOC(ICACHE_SIZE + object->len);
 	csp->obj.addr = (char *)csp + ICACHE_SIZE;
 	csp->refcnt = csp->zb_refcnt = 0;
+	csp->recently_used = FALSE;
 	assert(!IS_IN_UNUSED_STRINGPOOL(src->str.addr, src->str.len));
 	csp->src = *src;
 	csp->obj.len = object->len;
@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2011 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -26,20 +26,28 @@
 
 GBLREF	hash_table_objcode	cache_table;
 GBLREF	int			indir_cache_mem_size;
+GBLREF	uint4			max_cache_memsize;	/* Maximum bytes used for indirect cache object code */
+GBLREF	uint4			max_cache_entries;	/* Maximum number of cached indirect compilations */
 
 error_def(ERR_MEMORY);
 
-void cache_table_rebuild()
+STATICFNDCL void cache_table_walk(boolean_t cold_only);
+
+/* Free every cache entry that is not referenced by a frame or ZBREAK. With "cold_only", entries used since the previous
+ * walk (see "recently_used" in cache_get) are instead given a second chance by just clearing their flag.
+ */
+STATICFNDEF void cache_table_walk(boolean_t cold_only)
 {
 	ht_ent_objcode 	*tabent, *topent;
 	cache_entry	*csp;
 
-	DBGCACHE((stdout, "cache_table_rebuild: Rebuilding indirect lookaside cache\n"));
 	for (tabent = cache_table.base, topent = cache_table.top; tabent < topent; tabent++)
 	{
 		if (HTENT_VALID_OBJCODE(tabent, cache_entry, csp))
 		{
-			if ((0 == csp->refcnt) && (0 == csp->zb_refcnt))
+			if (cold_only && csp->recently_used)
+				csp->recently_used = FALSE;
+			else if ((0 == csp->refcnt) && (0 == csp->zb_refcnt))
 			{
 				((ihdtyp *)(csp->obj.addr))->indce = NULL;
 				indir_cache_mem_size -= (ICACHE_SIZE + csp->obj.len);
@@ -48,9 +56,27 @@ void cache_table_rebuild()
 			}
 		}
 	}
+}
+
+/* Release unreferenced cache entries. With "cold_only" (used by cache_put when the cache fills up), only entries not used
+ * since the previous eviction are released so a hot working set of indirection/XECUTE strings stays resident; if that does
+ * not bring the cache down to its low-water mark (CACHE_OVER_LOW_MARK) all unreferenced entries are released, so each
+ * eviction leaves headroom for several cache_put calls. The table is compacted at most once.
+ */
+void cache_table_evict(boolean_t cold_only)
+{
+	cache_table_walk(cold_only);
+	if (cold_only && CACHE_OVER_LOW_MARK)
+		cache_table_walk(FALSE);
 	/* Only do compaction processing if we are not processing a memory type error (which
 	 * involves allocating a smaller table with storage we don't have.
 	 */
 	if (COMPACT_NEEDED(&cache_table) && (error_condition != ERR_MEMORY))
 		compact_hashtab_objcode(&cache_table);
 }
+
+void cache_table_rebuild()
+{
+	DBGCACHE((stdout, "cache_table_rebuild: Rebuilding indirect lookaside cache\n"));
+	cache_table_evict(FALSE);
+}
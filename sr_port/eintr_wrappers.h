@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -434,6 +434,18 @@ static inline size_t gtm_fwrite(void *buff, size_t elemsize, size_t nelems, FILE
 	HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;			\
 }
 
+#define PREAD_FILE(FD, BUF, SIZE, OFFSET, RC)			\
+{								\
+	do							\
+	{							\
+		RC = pread(FD, BUF, SIZE, OFFSET);		\
+		if ((-1 != RC) || (EINTR != errno))		\
+			break;					\
+		eintr_handling_check();				\
+	} while (TRUE);						\
+	HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;			\
+}
+
 #define RECV(SOCKET, BUF, LEN, FLAGS, RC)			\
 {								\
 	do							\
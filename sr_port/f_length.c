@@ -2,6 +2,9 @@
  *								*
  *	Copyright 2001, 2011 Fidelity Information Services, Inc	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -14,10 +17,15 @@
 #include "opcode.h"
 #include "toktyp.h"
 #include "advancewindow.h"
+#include "op.h"
+#include "gtm_utf8.h"
+
+GBLREF boolean_t        gtm_utf8_mode;
 
 int f_length(oprtype *a, opctype op)
 {
 	triple *r;
+	mval tmp_mval;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -31,6 +39,19 @@ int f_length(oprtype *a, opctype op)
 		r->opcode = (OC_FNLENGTH == op) ? OC_FNPOPULATION : OC_FNZPOPULATION;      /* Not good information hiding */
 		if (EXPR_FAIL == expr(&(r->operand[1]), MUMPS_STR))
 			return FALSE;
+	} else if ((OC_LIT == r->operand[0].oprval.tref->opcode)
+		&& (!gtm_utf8_mode || valid_utf_string(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v.str)))
+	{	/* Single argument $[Z]LENGTH of a literal: compute it at compile time */
+		if (OC_FNLENGTH == r->opcode)
+			op_fnlength(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v, &tmp_mval);
+		else
+			op_fnzlength(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v, &tmp_mval);
+		unuse_literal(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v);	/* knock out abandoned use of a literal */
+		r->operand[0].oprval.tref->operand[0].oprclass = NO_REF;
+		r->operand[0].oprval.tref->opcode = OC_NOOP;				/* sideline abandoned triple */
+		*a = put_lit(&tmp_mval);
+		a->oprval.tref->src = r->src;
+		return TRUE;
 	}
 	ins_triple(r);
 	*a = put_tref(r);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -18,7 +18,10 @@
 
 /* Note, FNPC_MAX should never exceed 254 since the value 255 is used to flag "invalid entry" */
 #define FNPC_MAX 50
-#define FNPC_ELEM_MAX 80
+/* Number of piece offsets cached per string. Pieces beyond this are found by rescanning from the last cached piece, so
+ * a loop over all pieces of a record with more fields than this degrades to O(fields**2) scanning.
+ */
+#define FNPC_ELEM_MAX 256
 #define FNPC_RECURR_MAX 2
 
 #ifdef DEBUG
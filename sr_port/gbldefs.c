@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -163,6 +163,7 @@ GBLDEF	boolean_t	wcs_noasyncio;		/* used in wcs_wtstart to disable asyncio in th
 GBLDEF	io_desc		*active_device;
 GBLDEF	bool		pin_shared_memory;
 GBLDEF	bool		hugetlb_shm_enabled;
+GBLDEF	bool		hugepage_heap_enabled;	/* advise THP for large private heap allocations */
 GBLDEF	bool		error_mupip,
 			file_backed_up,
 			gv_replopen_error,
@@ -1318,12 +1319,13 @@ GBLDEF	boolean_t	noThreadAPI_active;		/* Any non-threaded API active (mumps, cal
  * and the callback function in each such sub-transaction could spawn multiple threads each of which can make
  * SimpleThreadAPI calls (e.g. ydb_set_st etc.) in which case we want all those calls in that sub-transaction
  * to execute one after the other.
- * Note: We initialize only ydb_engine_threadsafe_mutex[0] to PTHREAD_MUTEX_INITIALIZER here. This is needed so
- * the first call to "ydb_init" works correctly. ydb_engine_threadsafe_mutex[1] to ydb_engine_threadsafe_mutex[STMWORKQUEUEDIM-1]
- * are initialized in "gtm_startup" which is invoked from within the first "ydb_init" call.
+ * Note: We initialize only ydb_engine_threadsafe_mutex[0] to YDB_ENGINE_MUTEX_INITIALIZER (see libyottadb_int.h for
+ * the mutex type that implies) here. This is needed so the first call to "ydb_init" works correctly.
+ * ydb_engine_threadsafe_mutex[1] to ydb_engine_threadsafe_mutex[STMWORKQUEUEDIM-1] are initialized (with the same
+ * mutex type) in "gtm_startup" which is invoked from within the first "ydb_init" call.
  * See the description of STMWORKQUEUEDIM in libyottadb_int.h for more details on how that macro is defined.
  */
-GBLDEF	pthread_mutex_t	ydb_engine_threadsafe_mutex[STMWORKQUEUEDIM] = { PTHREAD_MUTEX_INITIALIZER };
+GBLDEF	pthread_mutex_t	ydb_engine_threadsafe_mutex[STMWORKQUEUEDIM] = { YDB_ENGINE_MUTEX_INITIALIZER };
 
 GBLDEF	pthread_t	ydb_engine_threadsafe_mutex_holder[STMWORKQUEUEDIM];
 								/* tid of thread that has YottaDB engine mutex currently locked */
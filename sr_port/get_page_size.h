@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -16,4 +19,31 @@
 void get_page_size(void);
 void get_hugepage_size(void);
 
+/* Transparent huge pages are 2MiB on the Linux platforms we support */
+#define THP_ALIGN_SIZE	((UINTPTR_T)2 * 1024 * 1024)
+
+/* If $ydb_hugepage_heap is set, ask the kernel to back the huge-page-aligned interior of a large private
+ * allocation (stringpool, big malloc pieces) with transparent huge pages to cut TLB misses. madvise() is
+ * purely advisory so any failure (THP disabled, kernel too old) is ignored and regular pages are used.
+ * Callers need <sys/mman.h>.
+ */
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+#define HUGEPAGE_MADVISE(ADDR, LEN)									\
+MBSTART {												\
+	UINTPTR_T	thp_start, thp_end;								\
+													\
+	GBLREF bool	hugepage_heap_enabled;								\
+													\
+	if (hugepage_heap_enabled && ((2 * THP_ALIGN_SIZE) <= (LEN)))					\
+	{												\
+		thp_start = ROUND_UP2((UINTPTR_T)(ADDR), THP_ALIGN_SIZE);				\
+		thp_end = ROUND_DOWN2((UINTPTR_T)(ADDR) + (LEN), THP_ALIGN_SIZE);			\
+		if (thp_start < thp_end)								\
+			(void)madvise((void *)thp_start, thp_end - thp_start, MADV_HUGEPAGE);		\
+	}												\
+} MBEND
+#else
+#define HUGEPAGE_MADVISE(ADDR, LEN)
+#endif
+
 #endif /* GET_PAGE_SIZE_INCLUDED */
@@ -3,7 +3,7 @@
  * Copyright (c) 2004-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -54,6 +54,7 @@
 #include "gds_blk_upgrade.h"
 #include "mlkdef.h"
 #include "getstorage.h"
+#include "sleep_cnt.h"
 
 #ifdef DEBUG
 #  define INITIAL_DEBUG_LEVEL GDL_Simple
@@ -91,6 +92,7 @@ GBLREF	size_t		zmalloclim;		/* ISV memory warning of MALLOCCRIT in bytes */
 GBLREF	boolean_t	malloccrit_issued;	/* MEMORY error limit set at time of MALLOCCRIT */
 GBLREF	bool		pin_shared_memory;	/* pin shared memory into physical memory on creation */
 GBLREF	bool		hugetlb_shm_enabled;	/* allocate shared memory backed by huge pages */
+GBLREF	bool		hugepage_heap_enabled;	/* advise transparent huge pages for large private allocations */
 
 #ifdef DEBUG
 GBLREF	block_id	ydb_skip_bml_num;
@@ -140,6 +142,11 @@ void	gtm_env_init(void)
 		ret = ydb_logical_truth_value(YDBENVINDX_HUGETLB_SHM, FALSE, &is_defined);
 		if (is_defined)
 			hugetlb_shm_enabled = ret; /* if env var is not defined, hugetlb_shm_enabled takes the default value */
+		/* ydb_hugepage_heap environment/logical */
+		assert(FALSE == hugepage_heap_enabled);
+		ret = ydb_logical_truth_value(YDBENVINDX_HUGEPAGE_HEAP, FALSE, &is_defined);
+		if (is_defined)
+			hugepage_heap_enabled = ret;
 		/* See if ydb_msgprefix is specified. If so store it in TREF(ydbmsgprefix).
 		 * Note: Default value is already stored in "gtm_threadgbl_init".
 		 * Do this initialization before most other variables so any error messages later issued in this module
@@ -345,6 +352,20 @@ void	gtm_env_init(void)
 												IGNORE_ERRORS_TRUE, NULL);
 		if (0 > TREF(tprestart_syslog_delta))
 			TREF(tprestart_syslog_delta) = 0;
+		/* Initialize $ydb_tp_final_retry_backoff. The backoff is done through "wcs_backoff" which sleeps at most
+		 * MAXSLPTIME msec, so that is also the largest value honored here.
+		 */
+		TREF(tp_final_retry_backoff) = ydb_trans_numeric(YDBENVINDX_TP_FINAL_RETRY_BACKOFF, &is_defined,
+												IGNORE_ERRORS_TRUE, NULL);
+		if (0 > TREF(tp_final_retry_backoff))
+			TREF(tp_final_retry_backoff) = 0;
+		else if (MAXSLPTIME < TREF(tp_final_retry_backoff))
+			TREF(tp_final_retry_backoff) = MAXSLPTIME;
+		/* Initialize $ydb_tp_revalidate_interval */
+		TREF(tp_revalidate_interval) = ydb_trans_numeric(YDBENVINDX_TP_REVALIDATE_INTERVAL, &is_defined,
+												IGNORE_ERRORS_TRUE, NULL);
+		if (0 > TREF(tp_revalidate_interval))
+			TREF(tp_revalidate_interval) = 0;
 		/* Initialize $ydb_nontprestart_log_first */
 		TREF(nontprestart_log_first) = ydb_trans_numeric(YDBENVINDX_NONTPRESTART_LOG_FIRST, &is_defined,
 												IGNORE_ERRORS_TRUE, NULL);
@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -45,6 +48,8 @@
 #  define findStorElem findStorElem_dbg
 #  define processDeferredFrees processDeferredFrees_dbg
 #  define release_unused_storage release_unused_storage_dbg
+#  define queueFreeStorElem queueFreeStorElem_dbg
+#  define combineDeferredStorElem combineDeferredStorElem_dbg
 #  define raise_gtmmemory_error raise_gtmmemory_error_dbg
 #  define gtm_bestfitsize gtm_bestfitsize_dbg
 #  define DEBUG
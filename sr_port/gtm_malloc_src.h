@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -74,6 +74,7 @@
 #include "gtm_malloc.h"
 #include "have_crit.h"
 #include "gtm_env_init.h"
+#include "get_page_size.h"
 #include "gtmio.h"
 #include "deferred_exit_handler.h"
 #include "deferred_events_queue.h"
@@ -255,6 +256,10 @@ MBSTART{												\
 	if (QUEUE_ANCHOR != uStor->queueIndex)		/* Does element exist? (Does queue point to itself?) */	\
 	{													\
 		DEQUEUE_STOR_ELEM(free, uStor);		/* It exists, dequeue it for use */			\
+		if ((NULL != deferredStorElems[sizeIndex])							\
+			&& (((unsigned long)deferredStorElems[sizeIndex] | TwoTable[sizeIndex])			\
+				== ((unsigned long)uStor | TwoTable[sizeIndex])))				\
+			deferredStorElems[sizeIndex] = NULL;	/* Allocating from the deferred pair breaks it up */	\
 		if (MAXINDEX == sizeIndex)									\
 		{	/* Allocating a MAXTWO block. Increment use counter for this subblock's block */	\
 			sEHdr = (storExtHdr *)((char *)uStor + uStor->extHdrOffset); 				\
@@ -389,6 +394,9 @@ STATICD storElem	freeStorElemQs[MAXINDEX + 1];	/* Need full element as queue anc
 							 */
 STATICD storExtHdr	storExtHdrQ;			/* List of storage blocks we allocate here */
 STATICD uint4		curExtents;			/* Number of current extents */
+STATICD storElem	*deferredStorElems[MAXINDEX + 1];	/* Per size, an element "gtm_free" queued without combining it
+								 * with its (also queued) free buddy. See "queueFreeStorElem".
+								 */
 #ifdef DEBUG
 STATICD storElem allocStorElemQs[MAXINDEX + 2];		/* The extra element is for queueing "real" malloc'd entries */
 #  ifdef INT8_SUPPORTED
@@ -429,6 +437,8 @@ error_def(ERR_MALLOCMAXUNIX);
 void gtmSmInit(void);
 storElem *findStorElem(int sizeIndex, int stack_level);
 void release_unused_storage(void);
+void queueFreeStorElem(storElem *uStor, int sizeIndex, boolean_t deferCombine);
+void combineDeferredStorElem(int sizeIndex);
 void *gtm_malloc_main(size_t, int stack_level);
 void gtm_free_main(void *, int stack_level);
 #ifdef DEBUG
@@ -750,6 +760,7 @@ void *gtm_malloc_main(size_t size, int stack_level)	/* Note renamed to gtm_mallo
 				} else
 				{	/* Use regular malloc to obtain the piece */
 					MALLOC(tSize, uStor);
+					HUGEPAGE_MADVISE(uStor, tSize);
 					totalRmalloc += tSize;
 					SET_MAX(rmallocMax, totalRmalloc);
 					uStor->queueIndex = REAL_MALLOC;
@@ -839,10 +850,9 @@ void *gtm_malloc_main(size_t size, int stack_level)	/* Note renamed to gtm_mallo
 /* #GTM_THREAD_SAFE : The below function (gtm_free) is thread-safe; serialization is ensured with locks */
 void gtm_free_main(void *addr, int stack_level)	/* Note renamed to gtm_free_dbg when included in gtm_malloc_dbg.c */
 {
-	storElem 	*uStor, *buddyElem;
-	storExtHdr	*sEHdr;
+	storElem 	*uStor;
 	unsigned char	*trailerMarker;
-	int 		sizeIndex, hdrSize, saveIndex, dqIndex, freedElemCnt;
+	int 		sizeIndex, hdrSize, saveIndex, dqIndex;
 	gtm_msize_t	saveSize, allocSize;
 	boolean_t	was_holder;
 	intrpt_state_t	prev_intrpt_state;
@@ -939,68 +949,7 @@ void gtm_free_main(void *addr, int stack_level)	/* Note renamed to gtm_free_dbg
 				INCR_CNTR(freeCnt[sizeIndex]);
 				assert(uStor->realLen == TwoTable[sizeIndex]);
 				totalAlloc -= TwoTable[sizeIndex];
-			        /* First, if there are larger queues than this one, see if it has a buddy that it can
-				 * combine with.
-				 */
-				while (sizeIndex < MAXINDEX)
-				{
-					buddyElem = (storElem *)((unsigned long)uStor ^ TwoTable[sizeIndex]);/* Address of buddy */
-					assert(0 == ((unsigned long)buddyElem & (TwoTable[sizeIndex] - 1)));/* Verify alignment */
-					assert(buddyElem->state == Allocated || buddyElem->state == Free);
-					assert(buddyElem->queueIndex >= 0 && buddyElem->queueIndex <= sizeIndex);
-					if (buddyElem->state == Allocated || buddyElem->queueIndex != sizeIndex)
-						/* All possible combines done */
-						break;
-
-					/* Remove buddy from its queue and make a larger element for a larger queue */
-					DEQUEUE_STOR_ELEM(free, buddyElem);
-					if (buddyElem < uStor)		/* Pick lower address buddy for top of new bigger block */
-						uStor = buddyElem;
-					++sizeIndex;
-					assert(sizeIndex >= 0 && sizeIndex <= MAXINDEX);
-					INCR_CNTR(elemCombines[sizeIndex]);
-					uStor->queueIndex = sizeIndex;
-				}
-#				ifdef DEBUG
-				/* Backfill entire block being freed so usage of it will cause problems */
-				if (GDL_SmBackfill & ydbDebugLevel)
-					backfill((unsigned char *)uStor + hdrSize, TwoTable[sizeIndex] - hdrSize);
-#				endif
-				ENQUEUE_STOR_ELEM(free, sizeIndex, uStor);
-				if (MAXINDEX == sizeIndex)
-				{	/* Freeing/Coagulating a MAXTWO block. Decrement use counter for this element's block */
-					sEHdr = (storExtHdr *)((char *)uStor + uStor->extHdrOffset);
-					--sEHdr->elemsAllocd;
-					assert(0 <= sEHdr->elemsAllocd);
-					/* Check for an extent being ripe for return to the system. Requirements are:
-					 *   1) All subblocks must be free (elemsAllocd == 0).
-					 *   2) There must be more than STOR_EXTENTS_KEEP extents already allocated.
-					 * If these conditions are met, we will dequeue each individual element from
-					 * it's queue and release the entire extent in a (real) free.
-					 */
-					if (STOR_EXTENTS_KEEP < curExtents && 0 == sEHdr->elemsAllocd)
-					{	/* Release this extent */
-						DEBUGSM(("debugsm: Extent being freed from 0x%08lx\n", sEHdr->elemStart));
-						DEBUG_ONLY(freedElemCnt = 0);
-						for (uStor = sEHdr->elemStart;
-						     (char *)uStor < (char *)sEHdr;
-						     uStor = (storElem *)((char *)uStor + MAXTWO))
-						{
-							DEBUG_ONLY(++freedElemCnt);
-							assert(Free == uStor->state);
-							assert(MAXINDEX == uStor->queueIndex);
-							DEQUEUE_STOR_ELEM(free, uStor);
-							DEBUGSM(("debugsm: ... element removed from free q 0x%08lx\n", uStor));
-						}
-						assert(ELEMS_PER_EXTENT <= freedElemCnt);	/* one loop to free them all */
-						assert((char *)uStor == (char *)sEHdr);
-						dqdel(sEHdr, links);
-						FREE(EXTENT_SIZE, sEHdr->extentStart);
-						totalRmalloc -= EXTENT_SIZE;
-						--curExtents;
-						assert(curExtents);
-					}
-				}
+				queueFreeStorElem(uStor, sizeIndex, TRUE);
 			} else
 			{
 				assert(REAL_MALLOC == sizeIndex);		/* Better be a real malloc type block */
@@ -1041,6 +990,131 @@ void gtm_free_main(void *addr, int stack_level)	/* Note renamed to gtm_free_dbg
 	DEFERRED_SIGNAL_HANDLING_CHECK;
 }
 
+/* Put a free element (of size TwoTable[sizeIndex]) back on the free queues, combining it with its free buddies as far as
+ * possible, and return its extent to the system if that leaves the extent entirely unused.
+ */
+/* #GTM_THREAD_SAFE : The below function (queueFreeStorElem) is thread-safe because caller ensures serialization with locks */
+/* Note renamed to queueFreeStorElem_dbg when included in gtm_malloc_dbg.c */
+void queueFreeStorElem(storElem *uStor, int sizeIndex, boolean_t deferCombine)
+{
+	storElem 	*buddyElem, *qHdr;
+	storExtHdr	*sEHdr;
+	DEBUG_ONLY(int	freedElemCnt;)
+	DEBUG_ONLY(int	hdrSize = OFFSETOF(storElem, userStorage);)
+
+	assert(IS_PTHREAD_LOCKED_AND_HOLDER);
+	assert(Free == uStor->state);
+	/* First, if there are larger queues than this one, see if it has a buddy that it can combine with. But if the
+	 * caller allows it and this size's free queue holds at most one element, leave the block uncombined so the next
+	 * allocation of this size is satisfied straight off the queue instead of re-splitting the block we would just have
+	 * built. This avoids a combine/split cycle on every free/malloc pair of a given size. A buddy pair left uncombined
+	 * this way keeps its MAXTWO block (and so its extent) in use, so it is remembered in deferredStorElems[] and
+	 * combined as soon as the queue grows past it (the next free of this size onto a non-empty queue). At most one
+	 * such pair exists per size.
+	 */
+	qHdr = &freeStorElemQs[sizeIndex];
+	if (deferCombine)
+	{
+		if (NULL != deferredStorElems[sizeIndex])
+			combineDeferredStorElem(sizeIndex);
+		deferCombine = (QUEUE_ANCHOR == STE_FP(STE_FP(qHdr))->queueIndex);
+	}
+	while (!deferCombine && (sizeIndex < MAXINDEX))
+	{
+		buddyElem = (storElem *)((unsigned long)uStor ^ TwoTable[sizeIndex]);/* Address of buddy */
+		assert(0 == ((unsigned long)buddyElem & (TwoTable[sizeIndex] - 1)));/* Verify alignment */
+		assert(buddyElem->state == Allocated || buddyElem->state == Free);
+		assert(buddyElem->queueIndex >= 0 && buddyElem->queueIndex <= sizeIndex);
+		if (buddyElem->state == Allocated || buddyElem->queueIndex != sizeIndex)
+			/* All possible combines done */
+			break;
+
+		/* Remove buddy from its queue and make a larger element for a larger queue */
+		DEQUEUE_STOR_ELEM(free, buddyElem);
+		if ((NULL != deferredStorElems[sizeIndex])
+				&& (((unsigned long)deferredStorElems[sizeIndex] | TwoTable[sizeIndex])
+					== ((unsigned long)uStor | TwoTable[sizeIndex])))
+			deferredStorElems[sizeIndex] = NULL;	/* The deferred pair is being combined here */
+		if (buddyElem < uStor)		/* Pick lower address buddy for top of new bigger block */
+			uStor = buddyElem;
+		++sizeIndex;
+		assert(sizeIndex >= 0 && sizeIndex <= MAXINDEX);
+		INCR_CNTR(elemCombines[sizeIndex]);
+		uStor->queueIndex = sizeIndex;
+	}
+#	ifdef DEBUG
+	/* Backfill entire block being freed so usage of it will cause problems */
+	if (GDL_SmBackfill & ydbDebugLevel)
+		backfill((unsigned char *)uStor + hdrSize, TwoTable[sizeIndex] - hdrSize);
+#	endif
+	ENQUEUE_STOR_ELEM(free, sizeIndex, uStor);
+	if (deferCombine && (sizeIndex < MAXINDEX))
+	{	/* Remember the pair if we actually left one uncombined */
+		buddyElem = (storElem *)((unsigned long)uStor ^ TwoTable[sizeIndex]);
+		if ((Free == buddyElem->state) && (sizeIndex == buddyElem->queueIndex))
+		{
+			assert(NULL == deferredStorElems[sizeIndex]);
+			deferredStorElems[sizeIndex] = uStor;
+		}
+	}
+	if (MAXINDEX == sizeIndex)
+	{	/* Freeing/Coagulating a MAXTWO block. Decrement use counter for this element's block */
+		sEHdr = (storExtHdr *)((char *)uStor + uStor->extHdrOffset);
+		--sEHdr->elemsAllocd;
+		assert(0 <= sEHdr->elemsAllocd);
+		/* Check for an extent being ripe for return to the system. Requirements are:
+		 *   1) All subblocks must be free (elemsAllocd == 0).
+		 *   2) There must be more than STOR_EXTENTS_KEEP extents already allocated.
+		 * If these conditions are met, we will dequeue each individual element from
+		 * it's queue and release the entire extent in a (real) free.
+		 */
+		if (STOR_EXTENTS_KEEP < curExtents && 0 == sEHdr->elemsAllocd)
+		{	/* Release this extent */
+			DEBUGSM(("debugsm: Extent being freed from 0x%08lx\n", sEHdr->elemStart));
+			DEBUG_ONLY(freedElemCnt = 0);
+			for (uStor = sEHdr->elemStart;
+			     (char *)uStor < (char *)sEHdr;
+			     uStor = (storElem *)((char *)uStor + MAXTWO))
+			{
+				DEBUG_ONLY(++freedElemCnt);
+				assert(Free == uStor->state);
+				assert(MAXINDEX == uStor->queueIndex);
+				DEQUEUE_STOR_ELEM(free, uStor);
+				DEBUGSM(("debugsm: ... element removed from free q 0x%08lx\n", uStor));
+			}
+			assert(ELEMS_PER_EXTENT <= freedElemCnt);	/* one loop to free them all */
+			assert((char *)uStor == (char *)sEHdr);
+			dqdel(sEHdr, links);
+			FREE(EXTENT_SIZE, sEHdr->extentStart);
+			totalRmalloc -= EXTENT_SIZE;
+			--curExtents;
+			assert(curExtents);
+		}
+	}
+}
+
+/* Combine the buddy pair "queueFreeStorElem" left uncombined for this size (if it is still intact) */
+/* #GTM_THREAD_SAFE : The below function (combineDeferredStorElem) is thread-safe because caller ensures serialization with locks */
+/* Note renamed to combineDeferredStorElem_dbg when included in gtm_malloc_dbg.c */
+void combineDeferredStorElem(int sizeIndex)
+{
+	storElem	*uStor, *buddyElem;
+
+	assert(IS_PTHREAD_LOCKED_AND_HOLDER);
+	assert((0 <= sizeIndex) && (MAXINDEX > sizeIndex));
+	uStor = deferredStorElems[sizeIndex];
+	if (NULL == uStor)
+		return;
+	deferredStorElems[sizeIndex] = NULL;
+	buddyElem = (storElem *)((unsigned long)uStor ^ TwoTable[sizeIndex]);
+	if ((Free == uStor->state) && (sizeIndex == uStor->queueIndex)
+			&& (Free == buddyElem->state) && (sizeIndex == buddyElem->queueIndex))
+	{
+		DEQUEUE_STOR_ELEM(free, uStor);
+		queueFreeStorElem(uStor, sizeIndex, FALSE);	/* also dequeues "buddyElem" */
+	}
+}
+
 /* When an out-of-storage type error is encountered, besides releasing our memory reserve, we also
  * want to release as much unused storage within various GTM queues that we can find.
  */
@@ -1048,6 +1122,7 @@ void gtm_free_main(void *addr, int stack_level)	/* Note renamed to gtm_free_dbg
 void release_unused_storage(void)	/* Note renamed to release_unused_storage_dbg when included in gtm_malloc_dbg.c */
 {
 	mcalloc_hdr	*curhdr, *nxthdr;
+	int		sizeIndex;
 
 	assert(IS_PTHREAD_LOCKED_AND_HOLDER);
 	/* Release compiler storage if we aren't in the compiling business currently */
@@ -1065,6 +1140,9 @@ void release_unused_storage(void)	/* Note renamed to release_unused_storage_dbg
 	   function pointer. */
 	if (NULL != cache_table_relobjs)
 		(*cache_table_relobjs)();	/* Release object code in indirect cache */
+	/* Last, combine the buddy pairs "gtm_free" left uncombined (including by the frees done above) */
+	for (sizeIndex = 0; sizeIndex < MAXINDEX; sizeIndex++)
+		combineDeferredStorElem(sizeIndex);
 }
 
 /* Raise ERR_MEMORY. Separate routine since is called from hashtable logic in place of the
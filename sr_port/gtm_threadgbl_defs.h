@@ -3,7 +3,7 @@
  * Copyright (c) 2010-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -201,6 +201,9 @@ THREADGBLDEF(tp_restart_entryref,		mval)				/* tp_restart position for reporting
 THREADGBLDEF(tp_restart_failhist_indx,		int4)				/* tp_restart dbg restart history index */
 THREADGBLDEF(tprestart_syslog_delta,		int4)				/* defines every n-th restart to be logged for tp */
 THREADGBLDEF(tprestart_syslog_first,		int4)				/* # of TP restarts logged unconditionally */
+THREADGBLDEF(tp_final_retry_backoff,		int4)				/* msec backoff (<= MAXSLPTIME) before final retry */
+THREADGBLDEF(tp_revalidate_interval,		int4)				/* # of tp_hist calls between read-set revalidations */
+THREADGBLDEF(tp_revalidate_count,		int4)				/* # of tp_hist calls since last read-set revalidation */
 THREADGBLAR1DEF(t_fail_hist_blk,		block_id,	(CDB_MAX_TRIES))/* array for TP tracing */
 THREADGBLAR1DEF(tp_fail_bttn,			trans_num,	(CDB_MAX_TRIES))/* array for TP tracing */
 THREADGBLAR1DEF(tp_fail_histtn,			trans_num,	(CDB_MAX_TRIES))/* array for TP tracing */
@@ -346,6 +349,13 @@ THREADGBLDEF(parms_cnt,                         unsigned int)
 THREADGBLDEF(sapi_query_node_subs,		mstr *)				/* -> Array of YDB_MAX_SUBS mstrs holding subs
 										 * .. to return to ydb_node_*_s(). */
 THREADGBLDEF(sapi_query_node_subs_cnt,		int)				/* Count of subs filled in */
+THREADGBLDEF(sapi_get_retry_val,		mval)				/* Global value ydb_get_s() could not return for lack
+										 * of space; kept for the caller's retry */
+THREADGBLDEF(sapi_get_retry_key,		gv_key *)			/* Key of sapi_get_retry_val */
+THREADGBLDEF(sapi_get_retry_gvt,		gv_namehead *)			/* gv_target of sapi_get_retry_val (NULL if none) */
+THREADGBLDEF(sapi_get_retry_csa,		sgmnt_addrs *)			/* Region of sapi_get_retry_val */
+THREADGBLDEF(sapi_get_retry_tn,			trans_num)			/* Region curr_tn when sapi_get_retry_val was read */
+THREADGBLDEF(sapi_get_retry_rlbk_cycle,		uint4)				/* Online rollback cycle at that point */
 THREADGBLAR1DEF(zpeek_regname,			char,		NAME_ENTRY_SZ)	/* Last $ZPEEK() region specified */
 THREADGBLDEF(zpeek_regname_len,			int)				/* Length of zpeekop_regname */
 THREADGBLDEF(zpeek_reg_ptr,			gd_region *)			/* Resolved pointer for zpeekop_regname */
@@ -362,6 +372,9 @@ THREADGBLDEF(sapi_mstrs_for_gc_indx,		int)				/* Index into gc mstr array of nex
 THREADGBLDEF(set_zroutines_cycle,		uint4)				/* Informs us if we changed $ZROUTINES between
 										 * linking a routine and invoking it
 										 */
+THREADGBLDEF(spgc_pause_cnt,			gtm_uint64_t)			/* # of stringpool garbage collections timed */
+THREADGBLDEF(spgc_pause_max_usecs,		gtm_uint64_t)			/* Longest stringpool garbage collection (usecs) */
+THREADGBLDEF(spgc_pause_tot_usecs,		gtm_uint64_t)			/* Total time in stringpool garbage collection */
 THREADGBLDEF(statsDB_init_defer_anchor,		statsDB_deferred_init_que_elem *) /* Anchor point for deferred init of statsDBs */
 THREADGBLDEF(statshare_opted_in,		uint4)				/* Flag controlling stats collection */
 THREADGBLDEF(trans_code_pop,			mval)				/* trans_code holder for $ZTRAP popping */
@@ -2,6 +2,9 @@
  *								*
  *	Copyright 2001, 2008 Fidelity Information Services, Inc	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -39,6 +42,28 @@ GBLREF	gtmrecv_options_t	gtmrecv_options;
 GBLREF	seq_num			seq_num_zero;
 GBLREF	seq_num			seq_num_one;
 
+/* Display how far behind the originating instance the update process has been applying transactions */
+STATICFNDEF void gtmrecv_show_lag(upd_proc_local_ptr_t upd_proc_local)
+{
+	gtm_uint64_t	count;
+	int		bucket;
+
+	util_out_print("!UL : seconds between originating commit and apply of last transaction processed by update process",
+			TRUE, upd_proc_local->last_lag);
+	for (bucket = 0; bucket < UPD_LAG_HIST_BUCKETS; bucket++)
+	{
+		count = upd_proc_local->lag_hist[bucket];
+		if (0 == bucket)
+			util_out_print("!@UQ : transactions applied with a lag of less than 1 second", TRUE, &count);
+		else if ((UPD_LAG_HIST_BUCKETS - 1) == bucket)
+			util_out_print("!@UQ : transactions applied with a lag of !UL seconds or more", TRUE, &count,
+					(1 << (bucket - 1)));
+		else
+			util_out_print("!@UQ : transactions applied with a lag of at least !UL and less than !UL seconds", TRUE,
+					&count, (1 << (bucket - 1)), (1 << bucket));
+	}
+}
+
 int gtmrecv_showbacklog(void)
 {
 	seq_num		seq_num, read_jnl_seqno, jnl_seqno;
@@ -62,6 +87,8 @@ int gtmrecv_showbacklog(void)
 	if (QWNE(seq_num, seq_num_zero))
 		QWDECRBY(seq_num, seq_num_one);
 	util_out_print("!@UQ : sequence number of last transaction processed by update process", TRUE, &seq_num);
+	if (QWNE(read_jnl_seqno, seq_num_zero))
+		gtmrecv_show_lag(recvpool.upd_proc_local);
 
 	return (NORMAL_SHUTDOWN);
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -368,6 +368,11 @@ int repl_ctl_create(repl_ctl_element **ctl, gd_region *reg, int jnl_fn_len, char
 	tmp_ctl->repl_buff->fc->jfh_base = tmp_jfh_base;
 	tmp_ctl->repl_buff->fc->jfh = tmp_jfh;
 	tmp_ctl->repl_buff->fc->fd = tmp_fd;
+	tmp_ctl->repl_buff->fc->readahead_addr = JNL_FILE_FIRST_RECORD;
+	/* Journal files are read front to back by the source server so let the kernel use a larger readahead window.
+	 * This is only a hint so any error is ignored.
+	 */
+	posix_fadvise(tmp_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
 	if (USES_ANY_KEY(tmp_jfh))
 	{
 		ASSERT_ENCRYPTION_INITIALIZED;	/* should be done in db_init ("gtmsource" -> "gvcst_init" -> "db_init") */
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -690,7 +690,21 @@ void FREE_HASHTAB(HASH_TABLE *table)
  */
 void REINITIALIZE_HASHTAB(HASH_TABLE *table)
 {
+	HT_ENT	*oldbase;
+
 	assert(TRUE == table->active);
+	/* A table that once grew large (e.g. TP blks_in_use after one big transaction) but is now lightly used would
+	 * otherwise be cleared in full on every reinitialization. Shrink it one step instead. All entries are being
+	 * discarded so there is nothing to move and EXPAND_HASHTAB hands us an already cleared table.
+	 */
+	if (COMPACT_NEEDED(table) && !table->defer_base_release)
+	{
+		oldbase = table->base;
+		table->count = table->del_count = 0;
+		EXPAND_HASHTAB(table, HT_REHASH_TABLE_SIZE(table));
+		if (oldbase != table->base)
+			return;
+	}
 	memset((char *)table->base, 0, (table->size * SIZEOF(HT_ENT)) + ((table->size / BITS_PER_UCHAR) + 1));
 	HT_FIELDS_COMMON_INIT(table);
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -1557,6 +1557,30 @@ MBSTART {					\
 
 #define	INIT_NUM_JREC_RSRV_ELEMS	4
 
+/* Ensure "jrs_array" can hold at least NUM_ELEMS elements without "jnl_write_reserve" having to expand it. This lets
+ * callers that know (an upper bound of) the number of journal records they are going to reserve do the allocation
+ * before grabbing crit instead of doing repeated malloc/memcpy/free while holding crit. Must not be invoked while
+ * any reservation is pending (i.e. only outside of crit) as the existing contents of "jrs_array" are not preserved.
+ * "jnl_write_phase2" resets "usedlen" once the reserved records are written so the assert below catches any attempt
+ * to drop reserved-but-unwritten records.
+ */
+#define	ENSURE_JBUF_RSRV_STRUCT_SPACE(JRS, NUM_ELEMS)							\
+MBSTART {												\
+	uint4	newlen;											\
+													\
+	assert(0 == (JRS)->usedlen);									\
+	if ((JRS)->alloclen < (NUM_ELEMS))								\
+	{												\
+		newlen = (!(JRS)->alloclen ? INIT_NUM_JREC_RSRV_ELEMS : (JRS)->alloclen);		\
+		while (newlen < (NUM_ELEMS))								\
+			newlen *= 2;									\
+		if (NULL != (JRS)->jrs_array)								\
+			free((JRS)->jrs_array);								\
+		(JRS)->jrs_array = (jrec_rsrv_elem_t *)malloc(newlen * SIZEOF(jrec_rsrv_elem_t));	\
+		(JRS)->alloclen = newlen;								\
+	}												\
+} MBEND
+
 /* END  : Structures used by "jnl_write_reserve" */
 
 #define JNL_SHARE_SIZE(X)	(JNL_ALLOWED(X) ? 							\
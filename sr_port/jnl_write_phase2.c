@@ -3,7 +3,7 @@
  * Copyright (c) 2016-2017 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -181,4 +181,5 @@ void	jnl_write_phase2(sgmnt_addrs *csa, jbuf_rsrv_struct_t *jrs)
 		JNL_PHASE2_WRITE_COMPLETE(csa, jbp, commit_index, freeaddr);
 	}
 	jrs->tot_jrec_len = 0;	/* reset needed to prevent duplicate calls to "jnl_write_phase2" for same curr_tn */
+	jrs->usedlen = 0;	/* all reserved records have been written; see assert in ENSURE_JBUF_RSRV_STRUCT_SPACE */
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2024 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries.*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -65,3 +65,4 @@
 #define YDB_ERR_ARGSLONGLINE -151028112
 #define YDB_ERR_ZGBLDIRUNDEF -151028122
 #define YDB_ERR_SHEBANGMEXT -151028130
+#define YDB_ERR_SRCREADJNLFILES -151028139
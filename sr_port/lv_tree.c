@@ -3,7 +3,7 @@
  * Copyright (c) 2011-2015 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -267,6 +267,19 @@ STATICFNDEF void lvAvlTreeNodeFltConv(lvTreeNodeNum *fltNode)
 	}													\
 }
 
+/* Point the lastLookup clue of tree LVT at NODE. MINNODE and MAXNODE are the keys immediately before and after NODE's subtree
+ * (NULL implies -INFINITY and +INFINITY respectively). They are only looked at when the corresponding child of NODE is NULL.
+ */
+#define	LV_AVL_TREE_CLUE_SET(LVT, NODE, MINNODE, MAXNODE)								\
+MBSTART {														\
+	treeSrchStatus	*lastLookup;											\
+															\
+	lastLookup = &(LVT)->lastLookup;										\
+	lastLookup->lastNodeLookedUp = (NODE);										\
+	lastLookup->lastNodeMin = (MINNODE);										\
+	lastLookup->lastNodeMax = (MAXNODE);										\
+} MBEND
+
 #ifdef DEBUG
 /* This function is currently DEBUG-only because no one is supposed to be calling it.
  * Callers are usually performance sensitive and should therefore use the LV_AVL_TREE_NUMKEY_CMP
@@ -491,6 +504,13 @@ lvTreeNode *lvAvlTreeKeyPrev(lvTree *lvt, treeKeySubscr *key)
 	{
 		prev = lvAvlTreePrev(node);
 		assert((NULL == prev) || (0 < lvAvlTreeKeySubscrCmp(key, prev)));
+		/* If "prev" is BELOW "node" (the rightmost node of the left subtree), move the lastLookup clue to it.
+		 * The next $ORDER(,-1) in a reverse traversal looks up exactly this key and would otherwise miss the clue
+		 * (it lies in the clue's left subtree) and do a full traversal. If "prev" is an ancestor of "node" instead,
+		 * the current clue's min-key bound already points to it so no clue update is needed in that case.
+		 */
+		if (NULL != node->avl_left)
+			LV_AVL_TREE_CLUE_SET(lvt, prev, ((NULL == prev->avl_left) ? lvAvlTreePrev(prev) : NULL), node);
 	} else
 	{
 		assert(NULL != parent);	/* lvAvlTreeLookup should have initialized this */
@@ -559,6 +579,13 @@ lvTreeNode *lvAvlTreeKeyNext(lvTree *lvt, treeKeySubscr *key)
 	{
 		next = lvAvlTreeNext(node);
 		assert((NULL == next) || (0 > lvAvlTreeKeySubscrCmp(key, next)));
+		/* If "next" is BELOW "node" (the leftmost node of the right subtree), move the lastLookup clue to it.
+		 * A $ORDER loop looks up exactly this key in the next iteration and would otherwise miss the clue
+		 * (it lies in the clue's right subtree) and do a full O(log(n)) traversal for every other subscript.
+		 * If "next" is an ancestor of "node" instead, the current clue's max-key bound already points to it.
+		 */
+		if (NULL != node->avl_right)
+			LV_AVL_TREE_CLUE_SET(lvt, next, node, ((NULL == next->avl_right) ? lvAvlTreeNext(next) : NULL));
 	} else
 	{
 		assert(NULL != parent);	/* lvAvlTreeLookup should have initialized this */
@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -11,6 +14,9 @@
  ****************************************************************/
 
 #include "mdef.h"
+
+#include "gtm_string.h"
+
 #include "matchc.h"
 
 #define	RETURN_NOMATCH			\
@@ -144,9 +150,8 @@ unsigned char *matchc(int del_len, unsigned char *del_str, int src_len, unsigned
 /* byte-oriented substring matching */
 unsigned char *matchb(int del_len, unsigned char *del_str, int src_len, unsigned char *src_str, int *res, int *numpcs)
 {
-	unsigned char 	*src_ptr, *pdel, *src_base, *src_top, *del_top;
-	int 		src_cnt, numpcs_unmatched;
-	boolean_t	match_found;
+	unsigned char 	*src_ptr, *src_base, *src_top, *src_last;
+	int 		numpcs_unmatched;
 
 	assert(0 <= del_len);
 	assert(0 < *numpcs);
@@ -161,38 +166,21 @@ unsigned char *matchb(int del_len, unsigned char *del_str, int src_len, unsigned
 	src_top = src_ptr + src_len;
 	if (src_len < del_len)	/* Input string is shorter than delimiter string so no match possible */
 		RETURN_NOMATCH;
-	del_top = del_str + del_len;
-	pdel = del_str;
-	while (src_ptr < src_top)
-	{
-		/* Quick Find 1st delimiter char */
-		while (*src_ptr != *pdel)
-		{
-			src_ptr = ++src_str;
-			if (src_ptr == src_top)
-				RETURN_NOMATCH;
-		}
-		match_found = FALSE;
-		/* Found delimiter */
-		while (*src_ptr++ == *pdel++)
-		{
-			if (pdel == del_top)
-			{	/* Found matching piece. */
-				match_found = TRUE;
-				break;
-			}
-			if (src_ptr == src_top)
-				RETURN_NOMATCH;
-		}
-		if (match_found)
-		{	/* Return success if no more pieces to match else continue with scan */
+	src_last = src_top - del_len;	/* Last position in source where a match can start */
+	while (src_str <= src_last)
+	{	/* Quick Find 1st delimiter char using "memchr" (which the C library vectorizes) and then verify the rest */
+		src_ptr = memchr(src_str, *del_str, src_last - src_str + 1);
+		if (NULL == src_ptr)
+			RETURN_NOMATCH;
+		if (0 == memcmp(src_ptr + 1, del_str + 1, del_len - 1))
+		{	/* Found matching piece. Return success if no more pieces to match else continue with scan */
+			src_ptr += del_len;
 			assert(0 < numpcs_unmatched);
 			if (0 == --numpcs_unmatched)
 				RETURN_YESMATCH(INTCAST(1 + (src_ptr - src_base)));
 			src_str = src_ptr;
 		} else
-			src_ptr = ++src_str; /* Match lost, goto next source character */
-		pdel = del_str;
+			src_str = src_ptr + 1; /* Match lost, goto next source character */
 	}
 	RETURN_NOMATCH;
 }
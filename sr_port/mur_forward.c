@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2019 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -17,6 +17,7 @@
 
 #include "gtm_signal.h"
 #include "gtm_unistd.h"
+#include "gtm_fcntl.h"
 #include "gtm_time.h"
 #include "gtm_string.h"
 #include "gtm_ipc.h"
@@ -191,7 +192,7 @@ int	mur_forward_multi_proc(reg_ctl_list *rctl)
 	boolean_t		multi_proc, this_reg_stuck, release_latch, ok_to_play;
 	boolean_t		cancelled_dbsync_timer;
 	reg_ctl_list		*rctl_top, *prev_rctl;
-	jnl_ctl_list		*jctl;
+	jnl_ctl_list		*jctl, *tmpjctl;
 	gd_region		*reg;
 	sgmnt_addrs		*csa;
 	seq_num 		rec_token_seq;
@@ -307,6 +308,22 @@ int	mur_forward_multi_proc(reg_ctl_list *rctl)
 			assert(NULL == rctl->jctl_turn_around);
 			jctl = rctl->jctl = rctl->jctl_head;
 			assert(jctl->reg_ctl == rctl);
+			/* With -AFTER_TIME, every record before that time is skipped below one at a time. A cleanly closed
+			 * journal file whose last record (eov_timestamp in the file header) is older than -AFTER_TIME has
+			 * nothing to contribute, so move past such generations using just the file header instead of
+			 * reading and discarding all of their records. Only do this when nothing is being applied to the
+			 * database (-AFTER_TIME is not allowed otherwise) and never skip the last generation of the chain.
+			 * With -VERIFY, every generation has to be read so its records are verified; skip nothing then.
+			 */
+			if (mur_options.after_time && !mur_options.update && !mur_options.verify)
+			{
+				while ((NULL != jctl->next_gen) && !jctl->jfh->crash
+						&& (jctl->jfh->eov_timestamp < mur_options.after_time))
+				{
+					jctl = rctl->jctl = jctl->next_gen;
+					assert(jctl->reg_ctl == rctl);
+				}
+			}
 			jctl->rec_offset = JNL_HDR_LEN;
 			jnl_fence_ctl.fence_list = JNL_FENCE_LIST_END; /* initialized to reflect journaling is not enabled */
 			if (mur_options.rollback)
@@ -361,6 +378,16 @@ int	mur_forward_multi_proc(reg_ctl_list *rctl)
 			gv_target = cs_addrs->dir_tree;
 		}
 		jctl->after_end_of_data = FALSE;
+		/* The forward phase reads every journal file of this region from the turn-around point to the end of the
+		 * chain exactly once and in order. Let the kernel read ahead aggressively on those files so the AIO reads
+		 * issued by "mur_next" are mostly satisfied from the page cache while this process is busy applying updates.
+		 * This is only a hint so errors are ignored.
+		 */
+		for (tmpjctl = jctl; NULL != tmpjctl; tmpjctl = tmpjctl->next_gen)
+		{
+			if (NOJNL != tmpjctl->channel)
+				posix_fadvise(tmpjctl->channel, 0, 0, POSIX_FADV_SEQUENTIAL);
+		}
 		status = mur_next(jctl, jctl->rec_offset);
 		assert(ERR_JNLREADEOF != status);	/* cannot get EOF at start of forward processing */
 		if (SS_NORMAL != status)
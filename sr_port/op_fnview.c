@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -239,6 +239,24 @@ void	op_fnview(int numarg, mval *dst, ...)
 			MV_FORCE_STR(arg2);
 			s2pool_concat(dst, &arg2->str);
 			break;
+		case VTK_SPGCSTATS:
+			/* <# of garbage collections>,<total usecs>,<longest usecs> */
+			commastr.len = 1;
+			commastr.addr = ",";
+			ENSURE_STP_FREE_SPACE((MAX_DIGITS_IN_INT8 * 3) + 2);
+			MV_FORCE_U64MVAL(dst, TREF(spgc_pause_cnt));
+			MV_FORCE_STR(dst);
+			dst->mvtype = vtp->restype;
+			s2pool_concat(dst, &commastr);
+			arg2 = &tmpmval;
+			MV_FORCE_U64MVAL(arg2, TREF(spgc_pause_tot_usecs));
+			MV_FORCE_STR(arg2);
+			s2pool_concat(dst, &arg2->str);
+			s2pool_concat(dst, &commastr);
+			MV_FORCE_U64MVAL(arg2, TREF(spgc_pause_max_usecs));
+			MV_FORCE_STR(arg2);
+			s2pool_concat(dst, &arg2->str);
+			break;
 		case VTK_GDSCERT:
 			if (certify_all_blocks)
 				*dst = literal_one;
@@ -3,6 +3,9 @@
  * Copyright (c) 2006-2015 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -31,6 +34,8 @@
 
 #include "mdef.h"
 
+#include "gtm_string.h"
+
 #include "fnpc.h"
 #include "min_max.h"
 #include "op.h"
@@ -124,7 +129,8 @@ void op_fnzp1(mval *src, int delim, int trgpcidx, mval *dst)
 	{
 		/* Once through for each piece we pass, last time through to find length of piece we want */
 		first = last;				/* first char of current piece */
-		while (last != end && *last != dlmc) last++;	/* Find delim signaling end of piece */
+		if (NULL == (last = memchr(last, dlmc, end - last)))	/* Find delim signaling end of piece */
+			last = end;
 		last++;					/* Bump past delim to first char next piece,
 							   or if hit last char, +2 past end of piece */
 		++cpcidx;				/* Next piece */
@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -56,6 +59,15 @@ typedef struct {
 
 #define REPL_BLKSIZE(x)		((x)->fc->jfh->alignsize)
 
+/* Number of REPL_BLKSIZE chunks the source server asks the kernel to prefetch ahead of the current read offset
+ * while catching up from a journal file whose end of data is final (i.e. a previous generation journal file).
+ */
+#define REPL_READAHEAD_BLKS	8
+/* Upper bound (in bytes) on that prefetch window. Needed since the journal alignsize (and hence REPL_BLKSIZE) can be as
+ * large as several hundred MiB.
+ */
+#define REPL_READAHEAD_MAX_BYTES	(64 * 1024 * 1024)
+
 #define	MARK_CTL_AS_EMPTY(CTL)						\
 {									\
 	assert(JNL_FILE_UNREAD == CTL->file_state);			\
@@ -67,6 +79,7 @@ typedef struct {
 typedef struct {
 	uint4		eof_addr;	/* On-disk last byte offset */
 	uint4		fs_block_size;	/* underlying journal file system block size */
+	uint4		readahead_addr;	/* offset upto which POSIX_FADV_WILLNEED has been issued on a closed generation */
 	jnl_file_header	*jfh_base;
 	jnl_file_header	*jfh;
 	int		fd;
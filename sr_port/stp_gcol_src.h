@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  * Copyright (c) 2017 Stephen L Johnson. All rights reserved.	*
@@ -20,6 +20,7 @@
 #include <stddef.h>
 #include "gtm_string.h"
 #include "gtm_stdio.h"
+#include "gtm_time.h"
 
 #include "gtmio.h"
 #include "gdsroot.h"
@@ -503,6 +504,10 @@ void stp_gcol(size_t space_asked)	/* BYPASSOK */
 	unsigned char		*old_free;
 	d_rm_struct		*rm_ptr;
 	UTF8_ONLY(utfcgr	*utfcgrp;)
+#	ifndef STP_MOVE
+	struct timespec		gcol_start, gcol_end;
+	gtm_uint64_t		gcol_usecs;
+#	endif
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -511,6 +516,7 @@ void stp_gcol(size_t space_asked)	/* BYPASSOK */
 	assert(!stringpool_unexpandable);
 	stringpool.gcols++;
 #	ifndef STP_MOVE
+	clock_gettime(CLOCK_MONOTONIC, &gcol_start);	/* for $VIEW("SPGCSTATS") */
 	/* Before we get cooking with our stringpool GC, check if it is appropriate to call lv_val garbage collection.
 	 * This is data that can get orphaned with no way to access it when aliases are used. This form of GC is only done
 	 * if aliases are actively being used. It is not called with every stringpool garbage collection but every "N"
@@ -917,6 +923,7 @@ void stp_gcol(size_t space_asked)	/* BYPASSOK */
 				MSTR_STPG_PUT(*cstr);
 			}
 		}
+		MVAL_STPG_ADD(&(TREF(sapi_get_retry_val)));	/* Value held by ydb_get_s() for an INVSTRLEN retry */
 		if (0 < TREF(sapi_query_node_subs_cnt))
 		{	/* Another set of mstrs used to return subscripts from ydb_node_{next,previous}_s() */
 			for (mstrp = TREF(sapi_query_node_subs), mstrp_top = mstrp + TREF(sapi_query_node_subs_cnt);
@@ -1135,6 +1142,13 @@ void stp_gcol(size_t space_asked)	/* BYPASSOK */
 	assert(stringpool.invokestpgcollevel <= stringpool.top);
 #	ifndef STP_MOVE
 	assert(stringpool.top - stringpool.free >= space_asked);
+	clock_gettime(CLOCK_MONOTONIC, &gcol_end);
+	gcol_usecs = ((gtm_uint64_t)(gcol_end.tv_sec - gcol_start.tv_sec) * MICROSECS_IN_SEC)
+			+ ((gcol_end.tv_nsec - gcol_start.tv_nsec) / NANOSECS_IN_USEC);
+	(TREF(spgc_pause_cnt))++;
+	(TREF(spgc_pause_tot_usecs)) += gcol_usecs;
+	if (TREF(spgc_pause_max_usecs) < gcol_usecs)
+		TREF(spgc_pause_max_usecs) = gcol_usecs;
 	if (IS_LVMON_ACTIVE && (stringpool.base == rts_stringpool.base))
 	{	/* Do monitoring only for runtime stringpool */
 		lvmon_pull_values(2);				/* Pull values of monitored vars into index 2 */
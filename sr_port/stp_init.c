@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -11,9 +14,15 @@
  ****************************************************************/
 
 #include "mdef.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #include "stringpool.h"
 #include "stp_parms.h"
 #include "mem_access.h"
+#include "get_page_size.h"
 
 GBLREF spdesc	stringpool;
 OS_PAGE_SIZE_DECLARE
@@ -42,6 +51,7 @@ void stp_init(size_t size)
         na_page[0] = na_page[1]
                    = (unsigned char *)
                 ((((UINTPTR_T)stringpool.base + size + SIZEOF(char *) + 2 * OS_PAGE_SIZE) & ~(OS_PAGE_SIZE - 1)) - OS_PAGE_SIZE);
+	HUGEPAGE_MADVISE(stringpool.base, size);
 	stringpool.lasttop = lasttop;
 	lasttop = stringpool.top = stringpool.invokestpgcollevel
 		= na_page[0] - SIZEOF(char *);
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2021 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -85,6 +85,8 @@ error_def(ERR_GVPUTFAIL);
 
 void	gds_tp_hist_moved(sgm_info *si, srch_hist *hist1);
 
+STATICFNDCL enum cdb_sc	tp_hist_revalidate(sgm_info *si);
+
 enum cdb_sc tp_hist(srch_hist *hist1)
 {
 	int			hist_index;
@@ -491,6 +493,17 @@ enum cdb_sc tp_hist(srch_hist *hist1)
 		 */
 		status = cdb_sc_wcs_recover;
 	}
+	/* If $ydb_tp_revalidate_interval is set, then every so many calls, check the entire read-set of this region (not just
+	 * the blocks of the current mini-action) for blocks that are certain to cause a restart in "tp_tend". Restarting now
+	 * avoids running the rest of a long transaction only to throw it away at commit time. Not done in the final retry as
+	 * we hold crit then and nothing can change underneath us.
+	 */
+	if ((cdb_sc_normal == status) && TREF(tp_revalidate_interval) && (CDB_STAGNATE > t_tries) && !is_mm
+			&& (++TREF(tp_revalidate_count) >= TREF(tp_revalidate_interval)))
+	{
+		TREF(tp_revalidate_count) = 0;
+		status = tp_hist_revalidate(si);
+	}
 	/* If validation has succeeded, assert that if ydb_gvundef_fatal is non-zero, then we better not signal a GVUNDEF */
 	assert((cdb_sc_normal != status) || !TREF(ydb_gvundef_fatal) || !ready2signal_gvundef_lcl);
 	ADD_TO_GVT_TP_LIST(gvt, RESET_FIRST_TP_SRCH_STATUS_FALSE);	/* updates gvt->read_local_tn & adds gvt to gvt_tp_list
@@ -558,3 +571,35 @@ void	gds_tp_hist_moved(sgm_info *si, srch_hist *hist1)
 	si->first_tp_hist = new_first_tp_hist;
 	si->last_tp_hist = (srch_blk_status *)((sm_uc_ptr_t)si->last_tp_hist + delta);
 }
+
+/* Check the read-set of the region corresponding to "si" out of crit and return cdb_sc_blkmod if it contains a leaf-level block,
+ * not updated by this transaction, that has been modified since it was read. "tp_tend" would restart on such a block (it does
+ * not allow the indexmod/noisolation optimizations for it) so there is no point in continuing with the transaction. Any block
+ * that is only possibly modified (index blocks, blocks with a cse, recycled cache-records) is left for "tp_tend" to decide.
+ */
+STATICFNDEF enum cdb_sc	tp_hist_revalidate(sgm_info *si)
+{
+	srch_blk_status		*t1;
+	cache_rec_ptr_t		cr;
+	trans_num		blktn;
+
+	SHM_READ_MEMORY_BARRIER;
+	for (t1 = si->first_tp_hist; t1 != si->last_tp_hist; t1++)
+	{
+		cr = t1->cr;
+		if ((NULL == cr) || (NULL != t1->cse) || t1->level)
+			continue;
+		blktn = ((blk_hdr_ptr_t)t1->buffaddr)->tn;
+		/* A cache-record that is reused for a different block gets its cycle incremented before its contents change
+		 * so an unchanged cycle after reading the block tn ensures the tn we read is that of the block in our history.
+		 */
+		SHM_READ_MEMORY_BARRIER;
+		if ((t1->tn <= blktn) && (t1->cycle == cr->cycle) && (t1->blk_num == cr->blk))
+		{
+			assert(CDB_STAGNATE > t_tries);
+			TP_TRACE_HIST_MOD(t1->blk_num, t1->blk_target, tp_blkmod_tp_hist, si->tp_csa->hdr, t1->tn, blktn, t1->level);
+			return cdb_sc_blkmod;
+		}
+	}
+	return cdb_sc_normal;
+}
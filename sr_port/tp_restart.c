@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -531,6 +531,24 @@ int tp_restart(int newlevel, boolean_t handle_errors_internally)
 					WAIT_FOR_REPL_INST_UNFREEZE_NOCSA;
 				/* fall through */
 			default:
+				if (((CDB_STAGNATE - 1) == t_tries) && ((CDB_STAGNATE - 1) == dollar_trestart)
+						&& TREF(tp_final_retry_backoff) && !is_final_retry_code(status)
+						&& !have_crit(CRIT_HAVE_ANY_REG))
+				{	/* The next try would be the final retry which holds crit on all participating regions for
+					 * the entire transaction, blocking every other updater of those regions. If the user has
+					 * asked for it ($ydb_tp_final_retry_backoff), give the conflicting processes a chance to
+					 * finish by backing off for a random time and then try optimistically once more (without
+					 * incrementing t_tries). The dollar_trestart check ensures this happens at most once per
+					 * transaction and never after a restart that did not count towards t_tries. Never sleep
+					 * while holding crit.
+					 */
+					wcs_backoff(TREF(tp_final_retry_backoff));
+#					ifdef DEBUG
+					if (0 <= TREF(tp_restart_dont_counts))	/* skip increment on negative from TPNOTACID */
+						(TREF(tp_restart_dont_counts))++;
+#					endif
+					break;
+				}
 				if (CDB_STAGNATE < ++t_tries)
 				{
 					assert(!is_final_retry_code(status));
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -139,6 +139,8 @@ error_def(ERR_TEXT);
 
 enum cdb_sc	reallocate_bitmap(sgm_info *si, cw_set_element *bml_cse);
 
+STATICFNDCL boolean_t	tp_tend_readonly_validate(sgm_info *si, sgmnt_addrs *csa);
+
 boolean_t	tp_crit_all_regions()
 {
 	int			lcnt;
@@ -233,6 +235,49 @@ boolean_t	tp_crit_all_regions()
 	return TRUE;
 }
 
+/* Validate the history of a region that this TP transaction only read from, without holding crit. This is called when
+ * the transaction number has moved since the blocks were read (so the "early_tn" fast path in "tp_tend" does not apply).
+ * Returns TRUE if every block in the history is still unmodified, in which case the region needs no validation in crit.
+ * Returns FALSE if the region needs to be validated the usual way (in crit); this is not a restart by itself.
+ *
+ * The checks done here are the same ones "tp_hist" does out of crit for every mini-action: the cdb_sc_blkmod check
+ * (cr->in_tend and the block transaction number) followed by the cdb_sc_lostcr check (cr->cycle), in that order.
+ * A committing process sets cr->in_tend on every buffer it is going to update (in "bg_update_phase1") while it still
+ * holds crit, and increments cr->cycle on an older twin. So if all history blocks pass, none of the commits that were
+ * serialized ahead of the point where we looked at the first block had touched the read set, and the values this
+ * transaction read are a consistent snapshot as of that point. Only BG is handled here; MM buffers can be remapped
+ * underneath us by a concurrent file extension so MM always validates in crit.
+ */
+STATICFNDEF boolean_t	tp_tend_readonly_validate(sgm_info *si, sgmnt_addrs *csa)
+{
+	node_local_ptr_t	cnl;
+	srch_blk_status		*t1;
+	cache_rec_ptr_t		cr;
+	enc_info_t		*encr_ptr;
+
+	assert(!si->update_trans && (NULL == si->first_cw_set));
+	if (csa->now_crit || (dba_bg != csa->hdr->acc_meth))
+		return FALSE;
+	cnl = csa->nl;
+	if ((0 != cnl->onln_rlbk_pid) || cnl->wc_blocked || MISMATCH_ROOT_CYCLES(csa, cnl))
+		return FALSE;
+	encr_ptr = csa->encr_ptr;
+	if ((NULL != encr_ptr) && (cnl->reorg_encrypt_cycle != encr_ptr->reorg_encrypt_cycle))
+		return FALSE;
+	/* See comment in "tp_hist" for why a read memory barrier is needed before looking at cr->in_tend and the block tn */
+	SHM_READ_MEMORY_BARRIER;
+	for (t1 = si->first_tp_hist; t1 != si->last_tp_hist; t1++)
+	{
+		cr = t1->cr;
+		if ((NULL == cr) || (NULL != t1->cse))
+			return FALSE;
+		/* blkmod check has to be done ahead of the cycle check. See comment in "tp_hist" for details. */
+		if (TP_IS_CDB_SC_BLKMOD(cr, t1) || (t1->cycle != cr->cycle))
+			return FALSE;
+	}
+	return TRUE;
+}
+
 boolean_t	tp_tend()
 {
 	block_id		tp_blk;
@@ -263,6 +308,7 @@ boolean_t	tp_tend()
 	uint4			jnl_status, leafmods, indexmods;
 	uint4			in_tend;
 	uint4			lcl_update_trans;
+	uint4			num_jrec_rsrv;
 	jnlpool_addrs_ptr_t	save_jnlpool, update_jnlpool, local_jnlpool;
 	jnlpool_ctl_ptr_t	jpl;
 	boolean_t		read_before_image; /* TRUE if before-image journaling or online backup in progress */
@@ -399,8 +445,16 @@ boolean_t	tp_tend()
 				 * our history buffer and we have reasonable values for first and last */
 				assert(si->last_tp_hist - si->first_tp_hist <= si->tp_hist_size);
 				continue;
-			} else
-				do_validation = TRUE;
+			}
+			/* Some other transaction committed since we read the blocks. If none of them touched any block that
+			 * we read, there is still no need to grab crit on this region just to validate the history.
+			 */
+			if (tp_tend_readonly_validate(si, csa))
+			{
+				assert(si->last_tp_hist - si->first_tp_hist <= si->tp_hist_size);
+				continue;
+			}
+			do_validation = TRUE;
 		} else
 		{
 			do_validation = TRUE;
@@ -434,6 +488,16 @@ boolean_t	tp_tend()
 					/* can't fit in current transaction's journal records into one journal file */
 					RTS_ERROR_CSA_ABT(csa, VARLSTCNT(6) ERR_JNLTRANS2BIG, 4, &tot_jrec_size,
 						JNL_LEN_STR(csd), csd->autoswitchlimit);
+				/* Size the journal reservation array for this region now so "jnl_write_reserve" does not need
+				 * to grow it while we hold crit. Every record (PINI, PBLKs, logical records and TCOM) can need
+				 * an ALIGN record ahead of it, hence the factor of 2.
+				 */
+				num_jrec_rsrv = 2;	/* PINI and TCOM */
+				if (csa->jnl_before_image)
+					num_jrec_rsrv += si->cw_set_depth;
+				for (jfb = si->jnl_head; NULL != jfb; jfb = jfb->next)
+					num_jrec_rsrv++;
+				ENSURE_JBUF_RSRV_STRUCT_SPACE(si->jbuf_rsrv_ptr, 2 * num_jrec_rsrv);
 			}
 			if (REPL_ALLOWED(csa))
 			{
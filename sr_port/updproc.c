@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -543,6 +543,7 @@ void updproc_actions(gld_dbname_list *gld_db_files)
 	seq_num			jnl_seqno, tmpseqno; /* the current jnl_seq no of the Update process */
 	seq_num			last_errored_seqno = 0;
 	int			key_len, rec_len, backptr;
+	jnl_tm_t		rec_time = 0;
 	char			fn[MAX_FN_LEN];
 	sm_uc_ptr_t		readaddrs;	/* start of current rec in pool */
 	boolean_t		incr_seqno;
@@ -768,6 +769,7 @@ void updproc_actions(gld_dbname_list *gld_db_files)
 		rec = (jnl_record *)readaddrs;
 		rectype = (enum jnl_record_type)rec->prefix.jrec_type;
 		rec_len = rec->prefix.forwptr;
+		rec_time = rec->prefix.time;	/* note down before the receiver server can reuse this part of the pool */
 		assert(IS_REPLICATED(rectype));
 		if ((JRT_TRIPLE == rectype) || (JRT_HISTREC == rectype))
 		{	/* Source server has sent a REPL_TRIPLE or REPL_HISTREC message in the middle of logical journal
@@ -1395,11 +1397,20 @@ void updproc_actions(gld_dbname_list *gld_db_files)
 		}
 		if (incr_seqno)
 		{
+			UPD_RECORD_LAG(upd_proc_local, rec_time);
+			assert(8 == UPD_LAG_HIST_BUCKETS);	/* the log message below prints 8 buckets */
 			if (jnl_seqno - lastlog_seqno >= log_interval)
 			{
 				repl_log(updproc_log_fp, TRUE, TRUE, "Jnl seq no : "INT8_FMT" "INT8_FMTX
 						 ";Rectype : %2d - %s\n", INT8_PRINT(jnl_seqno), INT8_PRINTX(jnl_seqno),
 						rectype, jrt_label[rectype]);
+				repl_log(updproc_log_fp, FALSE, TRUE, "Apply lag (seconds) : last %u ; histogram "
+						"[0] %llu [1] %llu [2-3] %llu [4-7] %llu [8-15] %llu [16-31] %llu [32-63] %llu "
+						"[64+] %llu\n", upd_proc_local->last_lag,
+						upd_proc_local->lag_hist[0], upd_proc_local->lag_hist[1],
+						upd_proc_local->lag_hist[2], upd_proc_local->lag_hist[3],
+						upd_proc_local->lag_hist[4], upd_proc_local->lag_hist[5],
+						upd_proc_local->lag_hist[6], upd_proc_local->lag_hist[7]);
 				lastlog_seqno = jnl_seqno;
 			}
 			upd_proc_local->read_jnl_seqno = ++jnl_seqno;
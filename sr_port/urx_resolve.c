@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2012 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -14,15 +14,44 @@
 
 #include "mdef.h"
 
+#include "gtm_string.h"
 #include "urx.h"
 
 GBLDEF urx_rtnref		urx_anchor;
 
+STATICFNDCL lab_tabent *urx_findlab(lab_tabent *lbl_tab, lab_tabent *lbl_top, urx_labref *lp);
+
+/* Binary search the (sorted) label table of the routine being linked for the unresolved label "lp".
+ * Returns NULL if the routine does not define that label.
+ */
+STATICFNDEF lab_tabent *urx_findlab(lab_tabent *lbl_tab, lab_tabent *lbl_top, urx_labref *lp)
+{
+	lab_tabent	*mid;
+	mident		lab_name;
+	int		comp;
+
+	lab_name.addr = (char *)&lp->name[0];
+	lab_name.len = lp->len;
+	while (lbl_tab < lbl_top)
+	{
+		mid = lbl_tab + (lbl_top - lbl_tab) / 2;
+		MIDENT_CMP(&mid->lab_name, &lab_name, comp);
+		if (0 == comp)
+			return mid;
+		if (0 > comp)
+			lbl_tab = mid + 1;
+		else
+			lbl_top = mid;
+	}
+	return NULL;
+}
+
 void urx_resolve(rhdtyp *rtn, lab_tabent *lbl_tab, lab_tabent *lbl_top)
 {
 	urx_rtnref	*rp0, *rp1;
-	urx_labref	*lp0, *lp1;
+	urx_labref	*lp0, *lp1, *lpnext;
 	urx_addr	*ap;
+	lab_tabent	*lbl_ent;
 
 	if (!urx_getrtn(rtn->routine_name.addr, rtn->routine_name.len, &rp0, &rp1, &urx_anchor))
 		return;
@@ -37,31 +66,37 @@ void urx_resolve(rhdtyp *rtn, lab_tabent *lbl_tab, lab_tabent *lbl_top)
 		rp1->addr = ap->next;
 		free(ap);
 	}
-	while (lbl_tab < lbl_top)
+	/* Walk this routine's unresolved label chain (typically short) and binary search the label table for each
+	 * entry, rather than searching the chain once per label in the table, which was O(labels * unresolved refs).
+	 * See urx_getlab() for why urx_rtnref can serve as the anchor (lp0) of the labref chain.
+	 */
+	lp0 = (urx_labref *)rp1;
+	for (lp1 = rp1->lab; 0 != lp1; lp1 = lpnext)
 	{
-		if (urx_getlab(lbl_tab->lab_name.addr, lbl_tab->lab_name.len, rp1, &lp0, &lp1))
+		lpnext = lp1->next;
+		if (NULL == (lbl_ent = urx_findlab(lbl_tab, lbl_top, lp1)))
+		{
+			lp0 = lp1;
+			continue;
+		}
+		while (0 != (ap = lp1->addr))	/* note the assignment! */
 		{
-			while (0 != (ap = lp1->addr))	/* note the assignment! */
-			{
-				assert(0 == *ap->addr);
-				*ap->addr =
-					USHBIN_ONLY((INTPTR_T)&lbl_tab->lnr_adr)
-					/* on non-shared binary resolve this address by adding the offset stored at lbl_tab address
-					 * to the routine header, to arrive at the address at which the current line number entry is
-					 * stored
-					 */
-					NON_USHBIN_ONLY((INTPTR_T)&lbl_tab->lab_ln_ptr);
-				lp1->addr = ap->next;
-				free(ap);
-			}
-			assert(0 == lp1->addr);
-			if (lp0 == (urx_labref *)rp1)
-				((urx_rtnref *)lp0)->lab = lp1->next;
-			else
-				lp0->next = lp1->next;
-			free(lp1);
+			assert(0 == *ap->addr);
+			*ap->addr =
+				USHBIN_ONLY((INTPTR_T)&lbl_ent->lnr_adr)
+				/* on non-shared binary resolve this address by adding the offset stored at lbl_tab address
+				 * to the routine header, to arrive at the address at which the current line number entry is
+				 * stored
+				 */
+				NON_USHBIN_ONLY((INTPTR_T)&lbl_ent->lab_ln_ptr);
+			lp1->addr = ap->next;
+			free(ap);
 		}
-		lbl_tab++;
+		if (lp0 == (urx_labref *)rp1)
+			((urx_rtnref *)lp0)->lab = lpnext;
+		else
+			lp0->next = lpnext;
+		free(lp1);
 	}
 	if (0 == rp1->lab)
 	{
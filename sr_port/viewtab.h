@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2022 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -119,6 +119,7 @@ VIEWTAB("RESETGVSTATS",		VTP_NULL,			VTK_RESETGVSTATS,	MV_STR),
 VIEWTAB("RTNCHECKSUM",		VTP_RTNAME,			VTK_RTNCHECKSUM,	MV_STR),
 VIEWTAB("RTNNEXT",		VTP_RTNAME,			VTK_RTNEXT,		MV_STR),
 VIEWTAB("SETENV",		VTP_VALUE,			VTK_SETENV,		MV_STR),
+VIEWTAB("SPGCSTATS",		VTP_NULL,			VTK_SPGCSTATS,		MV_STR),
 VIEWTAB("SPSIZE",		VTP_NULL,			VTK_SPSIZE,		MV_STR),
 VIEWTAB("STATSHARE",		VTP_NULL | VTP_DBREGION,	VTK_STATSHARE,		MV_NM),
 VIEWTAB("STKSIZ",		VTP_NULL,			VTK_STKSIZ,		MV_NM),
@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2018-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -79,6 +79,7 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_GBLDIR,                     "$ydb_gbldir",
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_GBLDIR_TRANSLATE,           "$ydb_gbldir_translate",           "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_GDSCERT,                    "$ydb_gdscert",                    "$gtm_gdscert")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_HOSTNAME,                   "$ydb_hostname",                   "")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_HUGEPAGE_HEAP,              "$ydb_hugepage_heap",              "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_HUGETLB_SHM,                "$ydb_hugetlb_shm",                "$gtm_hugetlb_shm")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_HUPENABLE,                  "$ydb_hupenable",                  "$gtm_hupenable")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_ICU_VERSION,                "$ydb_icu_version",                "$gtm_icu_version")
@@ -146,6 +147,8 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TMP_ONLY,                   "$ydb_tmp",
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TPNOTACIDTIME,              "$ydb_tpnotacidtime",              "$gtm_tpnotacidtime")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TPRESTART_LOG_DELTA,        "$ydb_tprestart_log_delta",        "$gtm_tprestart_log_delta")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TPRESTART_LOG_FIRST,        "$ydb_tprestart_log_first",        "$gtm_tprestart_log_first")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TP_FINAL_RETRY_BACKOFF,     "$ydb_tp_final_retry_backoff",     "")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TP_REVALIDATE_INTERVAL,     "$ydb_tp_revalidate_interval",     "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TRACE_GBL_NAME,             "$ydb_trace_gbl_name",             "$gtm_trace_gbl_name")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TRACE_GROUPS,               "$ydb_trace_groups",               "$gtm_trace_groups")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TRACE_TABLE_SIZE,           "$ydb_trace_table_size",           "$gtm_trace_table_size")
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2022-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2022-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -24,7 +24,7 @@
 #define GDS_LABEL_GENERIC	"GDSDYNUNX"
 #define GDS_LABEL		GDS_LABEL_GENERIC GDS_CURR_NO_PAREN	/* This string must be of length GDS_LABEL_SZ */
 #define V6_GDS_LABEL		GDS_LABEL_GENERIC GDS_V50	/* Any changes must be copied to the definition in v6_gdsfhead.h */
-#define GDS_RPL_LABEL		"GDSRPLUNX04"	/* format of journal pool and receive pool (must be of length GDS_LABEL_SZ) */
+#define GDS_RPL_LABEL		"GDSRPLUNX05"	/* format of journal pool and receive pool (must be of length GDS_LABEL_SZ) */
 
 /* Check O_DIRECT alignment requirements for each supported platform */
 #define	DIO_ALIGNSIZE(udi)	((udi)->db_fs_block_size)
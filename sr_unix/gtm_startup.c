@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -157,6 +157,7 @@ void gtm_startup(struct startup_vector *svec)
 	stack_frame 		*frame_pointer_lcl;
 	static char 		other_mode_buf[] = "OTHER";
 	int			i, status;
+	pthread_mutexattr_t	engine_mutex_attr;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -326,9 +327,23 @@ void gtm_startup(struct startup_vector *svec)
 	 * Note that this initialization routine does not have a return code so an error return code back to the caller
 	 * is not currently possible. This could probably be addressed but the process-killing rts_error suffices for now.
 	 */
+	status = pthread_mutexattr_init(&engine_mutex_attr);
+	if (status)
+	{
+		assert(FALSE);
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(8) ERR_SYSCALL, 5,
+			RTS_ERROR_LITERAL("pthread_mutexattr_init()"), CALLFROM, status);
+	}
+	status = pthread_mutexattr_settype(&engine_mutex_attr, YDB_ENGINE_MUTEX_TYPE);
+	if (status)
+	{
+		assert(FALSE);
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(8) ERR_SYSCALL, 5,
+			RTS_ERROR_LITERAL("pthread_mutexattr_settype()"), CALLFROM, status);
+	}
 	for (i = 1; i < STMWORKQUEUEDIM; i++)
 	{
-		status = pthread_mutex_init(&ydb_engine_threadsafe_mutex[i], NULL);
+		status = pthread_mutex_init(&ydb_engine_threadsafe_mutex[i], &engine_mutex_attr);
 		if (status)
 		{
 			assert(FALSE);
@@ -336,6 +351,7 @@ void gtm_startup(struct startup_vector *svec)
 				RTS_ERROR_LITERAL("pthread_mutex_init()"), CALLFROM, status);
 		}
 	}
+	pthread_mutexattr_destroy(&engine_mutex_attr);
 	/* Pick up the parms for this invocation */
 	if ((GTM_IMAGE == image_type) && (NULL != svec->base_addr))
 		/* We are in the grandchild at this point. This call is made to greet local variables sent from the midchild. There
@@ -3,7 +3,7 @@
  * Copyright (c) 2006-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2020-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -31,6 +31,11 @@
 #define DEFAULT_UPD_HELPERS_STR		"8,5"	/* Built as "DEFAULT_UPD_HELPERS,DEFAULT_UPD_HELP_READERS". Maintain DEFAULT for
 						 * /helpers in vvms:mupip_cmd.cld in sync with DEFAULT_UPD_HELPERS_STR */
 
+#define UPD_LAG_HIST_BUCKETS		8	/* Bucket 0 counts transactions applied within the second they were committed
+						 * on the originating instance; bucket i (i > 0) counts lags in [2**(i-1), 2**i)
+						 * seconds and the last bucket also counts everything larger.
+						 */
+
 #ifdef VMS
 #define MAX_GSEC_KEY_LEN		32 /* 31 is allowed + 1 for NULL terminator */
 #endif
@@ -202,8 +207,29 @@ typedef struct
 	char		log_file[MAX_FN_LEN + 1];
 	volatile uint4	onln_rlbk_flg;		/* Set to TRUE every time update process sees an online rollback. Set to FALSE ONLY
 						 * by receiver server */
+	volatile uint4	last_lag;		/* Seconds between originating commit and apply of the last transaction played */
+	volatile gtm_uint64_t	lag_hist[UPD_LAG_HIST_BUCKETS];	/* Transactions played, bucketed by lag in seconds.
+								 * See UPD_LAG_HIST_BUCKETS for the bucket boundaries. */
 } upd_proc_local_struct;
 
+/* Record the lag between the time a transaction was committed on the originating instance (the time stamp in its journal
+ * records) and the time the update process finished playing it. Clock skew between instances can make the difference
+ * negative; treat that as no lag. Only the update process updates these fields so no locking is needed.
+ */
+#define	UPD_RECORD_LAG(UPD_PROC_LOCAL, REC_TIME)						\
+MBSTART {											\
+	time_t		lcl_now;								\
+	uint4		lcl_lag;								\
+	int		lcl_bucket;								\
+												\
+	lcl_now = time(NULL);									\
+	lcl_lag = ((time_t)(REC_TIME) < lcl_now) ? (uint4)(lcl_now - (time_t)(REC_TIME)) : 0;	\
+	for (lcl_bucket = 0; (lcl_bucket < (UPD_LAG_HIST_BUCKETS - 1)) && (lcl_lag >> lcl_bucket); lcl_bucket++)	\
+		;										\
+	(UPD_PROC_LOCAL)->last_lag = lcl_lag;							\
+	(UPD_PROC_LOCAL)->lag_hist[lcl_bucket]++;						\
+} MBEND
+
 /*
  * The following structure contains data items local to the Receiver Server,
  * but are in the Receive Pool to provide for persistence across instantiations
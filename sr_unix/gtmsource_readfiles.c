@@ -3,7 +3,7 @@
  * Copyright (c) 2006-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -91,6 +91,28 @@ MBSTART {													\
 
 #define BUNCHING_TIME	(8 * (uint8)NANOSECS_IN_SEC)
 
+/* A journal file whose end of data is final (previous generation) is read sequentially until its end when the source
+ * server is catching up from the files. Keep the kernel prefetching REPL_READAHEAD_BLKS buffers (but no more than
+ * REPL_READAHEAD_MAX_BYTES) ahead of the current read offset so the synchronous reads done by "repl_read_file" are mostly
+ * satisfied from the page cache. The hint is issued only once a buffer (or half the window if that is smaller) has been
+ * consumed to avoid a system call per read. The window arithmetic is done in 64 bits as REPL_BLKSIZE can be very large.
+ */
+#define	REPL_JNL_READAHEAD(RB, FC, READ_END, DSKADDR)								\
+MBSTART {													\
+	gtm_uint64_t	ra_start, ra_end, ra_window, ra_refill;							\
+														\
+	ra_window = MIN(REPL_READAHEAD_BLKS * (gtm_uint64_t)REPL_BLKSIZE(RB), REPL_READAHEAD_MAX_BYTES);	\
+	ra_refill = MIN((gtm_uint64_t)REPL_BLKSIZE(RB), ra_window / 2);						\
+	ra_start = MAX((FC)->readahead_addr, (READ_END));							\
+	if ((ra_start < (DSKADDR)) && ((ra_start - (READ_END)) < (ra_window - ra_refill)))			\
+	{													\
+		ra_end = MIN(ra_start + ra_window, (gtm_uint64_t)(DSKADDR));					\
+		assert(ra_end > ra_start);									\
+		posix_fadvise((FC)->fd, (off_t)ra_start, (off_t)(ra_end - ra_start), POSIX_FADV_WILLNEED);	\
+		(FC)->readahead_addr = (uint4)ra_end;								\
+	}													\
+} MBEND
+
 #define	GTMSRC_DO_JNL_FLUSH_IF_POSSIBLE(CTL, CSA)									\
 MBSTART {														\
 	boolean_t		flush_done;										\
@@ -248,17 +270,15 @@ static	int repl_read_file(repl_buff_t *rb)
 	}
 	start_addr = ROUND_DOWN2(b->readaddr, fc->fs_block_size);
 	end_addr = ROUND_UP2(b->readaddr + b->buffremaining - read_less, fc->fs_block_size);
-	if ((off_t)-1 == lseek(fc->fd, (off_t)start_addr, SEEK_SET))
-	{
-		repl_errno = EREPL_JNLFILESEEK;
-		return (errno);
-	}
-	READ_FILE(fc->fd, b->base + REPL_BLKSIZE(rb) - b->buffremaining - (b->readaddr - start_addr),
-		  end_addr - start_addr, nb);
+	if (rb->backctl->eof_addr_final)
+		REPL_JNL_READAHEAD(rb, fc, end_addr, dskaddr);
+	/* Use a positional read so a catch-up read costs one system call instead of an lseek() and a read() */
+	PREAD_FILE(fc->fd, b->base + REPL_BLKSIZE(rb) - b->buffremaining - (b->readaddr - start_addr),
+		  end_addr - start_addr, (off_t)start_addr, nb);
 	status = errno;
 	if (nb < (b->readaddr - start_addr))
 	{	/* This case means that we didn't read enough bytes to get from the alignment point in the disk file
-		 * to the start of the actual desired read (the offset we did the lseek to above).  This can't happen
+		 * to the start of the actual desired read (the offset we did the pread at above).  This can't happen
 		 * and represents an out of design situation and we must return an error.
 		 */
 		assert(FALSE);
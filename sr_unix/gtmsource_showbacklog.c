@@ -3,7 +3,7 @@
  * Copyright (c) 2006-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2023-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2023-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -55,6 +55,7 @@ GBLREF	boolean_t		holds_sem[NUM_SEM_SETS][NUM_SRC_SEMS];
 error_def(ERR_LASTTRANS);
 error_def(ERR_SRCSRVNOTEXIST);
 error_def(ERR_SRCBACKLOGSTATUS);
+error_def(ERR_SRCREADJNLFILES);
 
 int gtmsource_showbacklog(void)
 {
@@ -146,6 +147,13 @@ int gtmsource_showbacklog(void)
 		if (!srv_alive)
 			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) MAKE_MSG_WARNING(ERR_SRCSRVNOTEXIST), 2,
 						LEN_AND_STR(gtmsourcelocal_ptr->secondary_instname));
+		else if ((GTMSOURCE_MODE_ACTIVE == gtmsourcelocal_ptr->mode) && (READ_FILE == gtmsourcelocal_ptr->read_state))
+		{	/* Each source server that has fallen out of the journal pool reads the journal files on its own.
+			 * Point that out so an operator can tell which secondaries are responsible for journal file I/O.
+			 */
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_SRCREADJNLFILES, 2,
+						LEN_AND_STR(gtmsourcelocal_ptr->secondary_instname));
+		}
 		if (NULL != jnlpool->gtmsource_local)
 			break;
 	}
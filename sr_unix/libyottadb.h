@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2017 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -416,6 +416,8 @@ int	ydb_node_next_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer
 			ydb_buffer_t *ret_subsarray);
 int	ydb_node_previous_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, int *ret_subs_used,
 			ydb_buffer_t *ret_subsarray);
+int	ydb_set_many_s(int count, const ydb_buffer_t *varnames, const int *subs_used, const ydb_buffer_t *subsarray,
+			const ydb_buffer_t *values, int *ret_count);
 int	ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *value);
 int	ydb_str2zwr_s(const ydb_buffer_t *str, ydb_buffer_t *zwr);
 int	ydb_subscript_next_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value);
@@ -444,6 +446,8 @@ int	ydb_node_next_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t
 			int *ret_subs_used, ydb_buffer_t *ret_subsarray);
 int	ydb_node_previous_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			int *ret_subs_used, ydb_buffer_t *ret_subsarray);
+int	ydb_set_many_st(uint64_t tptoken, ydb_buffer_t *errstr, int count, const ydb_buffer_t *varnames, const int *subs_used,
+			const ydb_buffer_t *subsarray, const ydb_buffer_t *values, int *ret_count);
 int	ydb_set_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			const ydb_buffer_t *value);
 int	ydb_str2zwr_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *str, ydb_buffer_t *zwr);
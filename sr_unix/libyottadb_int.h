@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -59,13 +59,28 @@ LITREF	char		*lydb_simplethreadapi_rtnnames[];
 								 * is 5 but in 32 bit mode the max is 6.
 								 */
 
-/* Dimension of the thread work queue array. It holds one extra so if we go one level too far, we don't have to worry about
- * detecting it. We can go ahead and pass it to ydb_tp_s() who will detect the issue and fail the request. Note TP_MAX_LEVEL
- * itself has a built-in extra element. It is defined as 127 but the actual max level is 126. This extra block (we use as the
- * [0] block as the main work queue and subsequent levels as the TP work levels.
+/* Dimension of the "ydb_engine_threadsafe_mutex" and "ydb_engine_threadsafe_mutex_holder" arrays. The name is historical:
+ * SimpleThreadAPI calls no longer go through work queues serviced by a worker thread. Each ydb_*_st() call runs the
+ * corresponding SimpleAPI function in the caller's own thread while holding the engine mutex for its TP level (see
+ * "threaded_api_ydb_engine_lock"), so there is no queue handoff or condition variable wait per call. The array holds one
+ * extra so if we go one level too far, we don't have to worry about detecting it. We can go ahead and pass it to ydb_tp_s()
+ * who will detect the issue and fail the request. Note TP_MAX_LEVEL itself has a built-in extra element. It is defined as 127
+ * but the actual max level is 126. Index [0] is the lock for non-TP calls and subsequent indices are the TP levels.
  */
 #define STMWORKQUEUEDIM (TP_MAX_LEVEL + 1)
 
+/* The YottaDB engine runs one SimpleThreadAPI call at a time, so threads contending for "ydb_engine_threadsafe_mutex" are
+ * typically waiting for one short call (e.g. a "ydb_get_st") to finish. Where available use an adaptive mutex, which spins
+ * briefly before blocking in the kernel, so the lock handoff between threads avoids a futex sleep/wakeup per call.
+ */
+#ifdef PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP
+#define YDB_ENGINE_MUTEX_INITIALIZER	PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP
+#define YDB_ENGINE_MUTEX_TYPE		PTHREAD_MUTEX_ADAPTIVE_NP
+#else
+#define YDB_ENGINE_MUTEX_INITIALIZER	PTHREAD_MUTEX_INITIALIZER
+#define YDB_ENGINE_MUTEX_TYPE		PTHREAD_MUTEX_DEFAULT
+#endif
+
 /* Values for TREF(libyottadb_active_rtn) */
 #define LYDBRTN(lydbtype, simpleapi_rtnname, simplethreadapi_rtnname)	lydbtype
 typedef enum
@@ -397,8 +412,11 @@ MBSTART {														\
 				rts_error_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_INVSVN);					\
 			if (UPDATE && !svn_data[iNDX].can_set)								\
 				rts_error_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_SVNOSET);					\
-			/* ISV usages are valid only if caller is "ydb_get_s" or "ydb_set_s". Else issue error. */	\
-			if ((LYDB_RTN_GET != LYDB_RTN_NAME) && (LYDB_RTN_SET != LYDB_RTN_NAME))				\
+			/* ISV usages are valid only if caller is "ydb_get_s", "ydb_set_s" or "ydb_set_many_s".		\
+			 * Else issue error.										\
+			 */												\
+			if ((LYDB_RTN_GET != LYDB_RTN_NAME) && (LYDB_RTN_SET != LYDB_RTN_NAME)				\
+					&& (LYDB_RTN_SET_MANY != LYDB_RTN_NAME))					\
 				rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_ISVUNSUPPORTED, 4,				\
 					(VARNAMEP)->len_used, (VARNAMEP)->buf_addr,					\
 					LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_NAME)));					\
@@ -925,6 +943,8 @@ MBSTART	{														\
 /* Define routines before get to inline routine definitions */
 int	sapi_return_subscr_nodes(int *ret_subs_used, ydb_buffer_t *ret_subsarray, char *ydb_caller_fn);
 void	sapi_save_targ_key_subscr_nodes(void);
+void	ydb_set_s_common(libyottadb_routines lydbrtn, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
+			const ydb_buffer_t *value);
 void	*ydb_stm_thread(void *parm);
 int	ydb_tp_s_common(libyottadb_routines lydbrtn,
 			ydb_basicfnptr_t tpfn, void *tpfnparm, const char *transid, int namecount, const ydb_buffer_t *varnames);
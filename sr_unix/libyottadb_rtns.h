@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2018-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -34,6 +34,7 @@ LYDBRTN(LYDB_RTN_LOCK_DECR, 		"ydb_lock_decr_s()",			"ydb_lock_decr_st()"			),	/
 LYDBRTN(LYDB_RTN_LOCK_INCR, 		"ydb_lock_incr_s()",			"ydb_lock_incr_st()"			),	/* "ydb_lock_incr_s" is running */
 LYDBRTN(LYDB_RTN_NODE_NEXT, 		"ydb_node_next_s()",			"ydb_node_next_st()"			),	/* "ydb_node_next_s" is running */
 LYDBRTN(LYDB_RTN_NODE_PREVIOUS, 	"ydb_node_previous_s()",		"ydb_node_previous_st()"		),	/* "ydb_node_previous_s" is running */
+LYDBRTN(LYDB_RTN_SET_MANY, 		"ydb_set_many_s()",			"ydb_set_many_st()"			),	/* "ydb_set_many_s" is running */
 LYDBRTN(LYDB_RTN_SET, 			"ydb_set_s()",				"ydb_set_st()"				),	/* "ydb_set_s" is running */
 LYDBRTN(LYDB_RTN_STR2ZWR,		"ydb_str2zwr_s()",			"ydb_str2zwr_st()"			),	/* "ydb_str2zwr_s" is running */
 LYDBRTN(LYDB_RTN_SUBSCRIPT_NEXT, 	"ydb_subscript_next_s()",		"ydb_subscript_next_st()"		),	/* "ydb_subscript_next_s" is running */
@@ -3,6 +3,9 @@
  * Copyright (c) 2006-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -47,7 +50,7 @@ void op_fnp1(mval *src, int delim, int trgpcidx,  mval *dst)
 	unsigned char	*first, *last, *start, *end;
 	unsigned int	*pcoff, *pcoffmax, fnpc_indx, slen;
 	int		trgpc, cpcidx, spcidx, mblen, dlmlen;
-	boolean_t       valid_char;
+	boolean_t       valid_char, byte_scan;
 	mval		ldst;		/* Local copy since &dst == &src .. move to dst at return */
 	fnpc   		*cfnpc;
 	delimfmt	ldelim;
@@ -132,38 +135,50 @@ void op_fnp1(mval *src, int delim, int trgpcidx,  mval *dst)
 		pcoffmax = &cfnpc->pstart[FNPC_ELEM_MAX];	/* Local end of array value */
 		cpcidx = 1;				/* current piece index */
 	}
+	/* An ASCII delimiter byte can never be part of a valid multi-byte character. So if the delimiter is ASCII and we
+	 * either know the source has no multi-byte characters or we need not check them for validity (BADCHAR inhibited),
+	 * we can find each delimiter with "memchr" rather than decoding the source one character at a time.
+	 */
+	byte_scan = ((1 == dlmlen) && (0x80 > ldelim.unibytes_val[0]) && (badchar_inhibit || MV_IS_SINGLEBYTE(src)));
 	/* Do scan filling in offsets of pieces if they fit in the cache */
 	spcidx = cpcidx;				/* Starting value for search */
 	while ((cpcidx <= trgpcidx) && (last < end))
 	{
 		/* Once through for each piece we pass, last time through to find length of piece we want */
 		first = last;				/* First char of current piece */
-		while (last < end)
+		if (byte_scan)
 		{
-			valid_char = UTF8_VALID(last, end, mblen);	/* Length of next char */
-			if (!valid_char)
-			{	/* Next character is not valid UTF8. If badchar error is not inhibited,
-				 * signal it now. If it is inhibited, just treat the character as a single
-				 * character and continue.
-				 */
-				if (!badchar_inhibit)
-					utf8_badchar(0, last, end, 0, NULL);
-				assert(1 == mblen);
-			}
-			/* Getting mblen first allows us to do quick length compare before the
-			 * heavier weight memcmp call.
-			 */
-			assert(0 < mblen);
-			if (mblen == dlmlen)
+			if (NULL == (last = memchr(last, ldelim.unibytes_val[0], end - last)))
+				last = end;
+		} else
+		{
+			while (last < end)
 			{
-				if (1 == dlmlen)
+				valid_char = UTF8_VALID(last, end, mblen);	/* Length of next char */
+				if (!valid_char)
+				{	/* Next character is not valid UTF8. If badchar error is not inhibited,
+					 * signal it now. If it is inhibited, just treat the character as a single
+					 * character and continue.
+					 */
+					if (!badchar_inhibit)
+						utf8_badchar(0, last, end, 0, NULL);
+					assert(1 == mblen);
+				}
+				/* Getting mblen first allows us to do quick length compare before the
+				 * heavier weight memcmp call.
+				 */
+				assert(0 < mblen);
+				if (mblen == dlmlen)
 				{
-					if (*last == ldelim.unibytes_val[0])			/* Shortcut - test single byte */
+					if (1 == dlmlen)
+					{
+						if (*last == ldelim.unibytes_val[0])			/* Shortcut - test single byte */
+							break;
+					} else if (0 == memcmp(last, ldelim.unibytes_val, dlmlen))	/* Longcut - for multibyte chk */
 						break;
-				} else if (0 == memcmp(last, ldelim.unibytes_val, dlmlen))	/* Longcut - for multibyte chk */
-					break;
+				}
+				last += mblen;  		/* Find delim signaling end of piece */
 			}
-			last += mblen;  		/* Find delim signaling end of piece */
 		}
 		last += dlmlen;				/* Bump past delim to first byte of next piece. The length of
 							 * the delimiter is assumed in the pcoff array and is removed
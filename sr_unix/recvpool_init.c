@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2020 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -471,6 +471,8 @@ void recvpool_init(recvpool_user pool_user, boolean_t gtmrecv_startup)
 		recvpool.upd_proc_local->upd_proc_pid_prev = 0;
 		recvpool.upd_proc_local->read_jnl_seqno = 0;
 		recvpool.upd_proc_local->read = 0;
+		recvpool.upd_proc_local->last_lag = 0;
+		memset((char *)recvpool.upd_proc_local->lag_hist, 0, SIZEOF(recvpool.upd_proc_local->lag_hist));
 		recvpool.gtmrecv_local->recv_serv_pid = process_id;
 		assert((NULL != jnlpool) && (NULL != jnlpool->jnlpool_ctl));
 		if ((NULL != jnlpool) && (NULL != jnlpool->jnlpool_ctl))
@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -34,8 +34,14 @@
 #include "deferred_events_queue.h"
 #include "min_max.h"
 #include "zshow.h"		/* needed for "format2zwr" prototype */
+#include "gvt_inline.h"	/* for GVKEY_INIT */
 
 GBLREF	volatile int4	outofband;
+GBLREF	gv_key		*gv_currkey;
+GBLREF	gv_namehead	*gv_target;
+GBLREF	gd_region	*gv_cur_region;
+GBLREF	sgmnt_addrs	*cs_addrs;
+GBLREF	uint4		dollar_tlevel;
 
 LITREF mval		literal_null;
 
@@ -54,7 +60,10 @@ LITREF mval		literal_null;
 int ydb_get_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value)
 {
 	boolean_t	error_encountered;
-	boolean_t	gotit, nospace;
+	boolean_t	gotit, nospace, use_retry;
+	sgmnt_addrs	*csa;
+	trans_num	retry_tn;
+	uint4		retry_rlbk_cycle;
 	gparam_list	plist;
 	ht_ent_mname	*tabent;
 	int		get_svn_index, i;
@@ -191,10 +200,56 @@ int ydb_get_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *su
 			COPY_PARMS_TO_CALLG_BUFFER(subs_used, subsarray, plist, plist_mvals, FALSE, 1,
 							LYDBRTNNAME(LYDB_RTN_GET));
 			callg((callgfnptr)op_gvname, &plist);		/* Drive "op_gvname" to create key */
+			/* A caller whose buffer was too small gets YDB_ERR_INVSTRLEN with the needed length and typically
+			 * retries right away with a bigger buffer. To spare that retry a second database search (several
+			 * for a value split across spanning nodes), a value that did not fit is held in the stringpool
+			 * and returned by the retry as long as nothing has committed in the region since it was read
+			 * (same curr_tn and online rollback cycle). Not done in TP where our own updates do not bump
+			 * curr_tn until commit.
+			 */
+			csa = cs_addrs;
+			use_retry = (!dollar_tlevel && IS_REG_BG_OR_MM(gv_cur_region) && (NULL != csa));
+			if (use_retry && (gv_target == TREF(sapi_get_retry_gvt)) && (csa == TREF(sapi_get_retry_csa))
+				&& (csa->ti->curr_tn == TREF(sapi_get_retry_tn))
+				&& (csa->nl->onln_rlbk_cycle == TREF(sapi_get_retry_rlbk_cycle))
+				&& (gv_currkey->end == (TREF(sapi_get_retry_key))->end)
+				&& (0 == memcmp(gv_currkey->base, (TREF(sapi_get_retry_key))->base, gv_currkey->end)))
+			{
+				get_value = TREF(sapi_get_retry_val);
+				/* Copy value to return buffer. If it still does not fit, the held value stays for another try */
+				SET_YDB_BUFF_T_FROM_MVAL(ret_value, &get_value, "NULL ret_value->buf_addr",
+								LYDBRTNNAME(LYDB_RTN_GET));
+				TREF(sapi_get_retry_gvt) = NULL;
+				(TREF(sapi_get_retry_val)).mvtype = 0;	/* Let the stringpool reclaim the value */
+				break;
+			}
+			if (NULL != TREF(sapi_get_retry_gvt))
+			{	/* A held value that this call did not match (different key or region, or stale) will not be
+				 * asked for again. Drop it so the stringpool can reclaim it.
+				 */
+				TREF(sapi_get_retry_gvt) = NULL;
+				(TREF(sapi_get_retry_val)).mvtype = 0;
+			}
+			if (use_retry)
+			{	/* Note the region state before the read so an update racing with it invalidates the held value */
+				retry_tn = csa->ti->curr_tn;
+				retry_rlbk_cycle = csa->nl->onln_rlbk_cycle;
+			}
 			gotit = op_gvget(&get_value);			/* Fetch value into get_value - should signal UNDEF
 									 * if value not found (and undef_inhibit not set)
 									 */
 			assert(gotit);
+			if (use_retry && MV_IS_STRING(&get_value) && ((unsigned)get_value.str.len > ret_value->len_alloc))
+			{
+				if (NULL == TREF(sapi_get_retry_key))
+					GVKEY_INIT(TREF(sapi_get_retry_key), DBKEYSIZE(MAX_KEY_SZ));
+				COPY_KEY(TREF(sapi_get_retry_key), gv_currkey);
+				TREF(sapi_get_retry_val) = get_value;
+				TREF(sapi_get_retry_gvt) = gv_target;
+				TREF(sapi_get_retry_csa) = csa;
+				TREF(sapi_get_retry_tn) = retry_tn;
+				TREF(sapi_get_retry_rlbk_cycle) = retry_rlbk_cycle;
+			}
 			/* Copy value to return buffer */
 			SET_YDB_BUFF_T_FROM_MVAL(ret_value, &get_value, "NULL ret_value->buf_addr", LYDBRTNNAME(LYDB_RTN_GET));
 			break;
@@ -0,0 +1,91 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "libyottadb_int.h"
+#include "op.h"
+#include "error.h"
+#include "stringpool.h"
+#include "deferred_events_queue.h"
+
+GBLREF	volatile int4	outofband;
+
+/* Routine to set a batch of local, global and ISV nodes in one call. Equivalent to calling "ydb_set_s" for each node in
+ * turn but pays the SimpleAPI entry/exit and condition handler setup once per batch instead of once per node (and in the
+ * SimpleThreadAPI flavor, takes the YottaDB engine lock once). Nodes are set in array order; callers ingesting into a global
+ * get the most benefit by passing keys in collation order, since consecutive updates then land in the same leaf block and
+ * are found through the gv_target clue rather than a fresh search from the root. The batch is not atomic - wrap the call in
+ * "ydb_tp_s" for that.
+ *
+ * Parameters:
+ *   count	- Number of nodes to set
+ *   varnames	- An array of "count" variable names
+ *   subs_used	- An array of "count" subscript counts, one per node
+ *   subsarray	- All subscripts of all nodes, concatenated in node order (the first subs_used[0] entries belong to
+ *		  node 0, the next subs_used[1] entries to node 1 and so on)
+ *   values	- An array of "count" values
+ *   ret_count	- If non-NULL, set to the number of nodes successfully set. On an error return, the node that failed
+ *		  is varnames[*ret_count].
+ */
+int ydb_set_many_s(int count, const ydb_buffer_t *varnames, const int *subs_used, const ydb_buffer_t *subsarray,
+		   const ydb_buffer_t *values, int *ret_count)
+{
+	boolean_t		error_encountered;
+	const ydb_buffer_t	*subs;
+	int			i;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
+					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
+					 * scenarios from not resetting this global variable even though this function returns.
+					 */
+	if (NULL != ret_count)
+		*ret_count = 0;
+	/* Verify entry conditions, make sure YDB CI environment is up etc. */
+	LIBYOTTADB_INIT(LYDB_RTN_SET_MANY, (int));	/* Note: macro could "return" from this function in case of errors */
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* previously unused entries should have been cleared by that
+							 * corresponding ydb_*_s() call.
+							 */
+	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+	if (error_encountered)
+	{
+		assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* should have been cleared by "ydb_simpleapi_ch" */
+		REVERT;
+		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
+	}
+	if (0 > count)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			      LEN_AND_LIT("Negative count"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_SET_MANY)));
+	if ((0 < count) && ((NULL == varnames) || (NULL == subs_used) || (NULL == values)))
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			      LEN_AND_LIT("NULL varnames, subs_used or values"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_SET_MANY)));
+	for (i = 0, subs = subsarray; i < count; i++)
+	{	/* Check if an outofband action that might care about has popped up. Done for every node, as "ydb_set_s"
+		 * would, so a large batch does not hold off Ctrl-C, MUPIP INTRPT or timers until it completes.
+		 */
+		if (outofband)
+			outofband_action(FALSE);
+		ydb_set_s_common(LYDB_RTN_SET_MANY, &varnames[i], subs_used[i], subs, &values[i]);
+		/* A negative subs_used[i] would have been reported by "ydb_set_s_common" above */
+		subs += subs_used[i];
+		if (NULL != ret_count)
+			*ret_count = i + 1;	/* Kept current so it is right even if the next node raises an error */
+	}
+	LIBYOTTADB_DONE;
+	REVERT;
+	return YDB_OK;
+}
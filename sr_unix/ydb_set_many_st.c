@@ -0,0 +1,44 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+
+#include "mdef.h"
+
+#include "libyottadb_int.h"
+
+GBLREF	boolean_t	caller_func_is_stapi;
+
+/* SimpleThreadAPI flavor of ydb_set_many_s(). The YottaDB engine lock is obtained once for the whole batch.
+ *
+ * Parms and return - same as ydb_set_many_s() except for the addition of tptoken and errstr.
+ */
+int ydb_set_many_st(uint64_t tptoken, ydb_buffer_t *errstr, int count, const ydb_buffer_t *varnames, const int *subs_used,
+		    const ydb_buffer_t *subsarray, const ydb_buffer_t *values, int *ret_count)
+{
+	libyottadb_routines	save_active_stapi_rtn;
+	ydb_buffer_t		*save_errstr;
+	boolean_t		get_lock;
+	int			retval;
+	DCL_THREADGBL_ACCESS;
+
+	LIBYOTTADB_RUNTIME_CHECK((int), errstr);	/* Note: Also does SETUP_THREADGBL_ACCESS; May return if error */
+	VERIFY_THREADED_API((int), errstr);
+	threaded_api_ydb_engine_lock(tptoken, errstr, LYDB_RTN_SET_MANY, &save_active_stapi_rtn, &save_errstr, &get_lock,
+				     &retval);
+	if (YDB_OK == retval)
+	{
+		caller_func_is_stapi = TRUE;	/* used to inform below SimpleAPI call that caller is SimpleThreadAPI */
+		retval = ydb_set_many_s(count, varnames, subs_used, subsarray, values, ret_count);
+		threaded_api_ydb_engine_unlock(tptoken, errstr, save_active_stapi_rtn, save_errstr, get_lock);
+	}
+	return retval;
+}
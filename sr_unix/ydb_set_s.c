@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -28,17 +28,16 @@
 
 GBLREF	volatile int4	outofband;
 
-/* Routine to set local, global and ISV values
+/* Sets one local, global or ISV node on behalf of "ydb_set_s" and "ydb_set_many_s". Errors are raised with "rts_error_csa"
+ * so the caller must have done LIBYOTTADB_INIT and established "ydb_simpleapi_ch".
  *
  * Parameters:
- *   varname	- Gives name of local, global or ISV variable
- *   subs_used	- Count of subscripts (if any else 0)
- *   subsarray  - an array of "subs_used" subscripts (not looked at if "subs_used" is 0)
- *   value	- Value to be set into local/global/ISV
+ *   lydbrtn	- SimpleAPI routine on whose behalf the SET is done (used in error messages)
+ *   varname, subs_used, subsarray, value - same as "ydb_set_s"
  */
-int ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *value)
+void ydb_set_s_common(libyottadb_routines lydbrtn, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
+		      const ydb_buffer_t *value)
 {
-	boolean_t	error_encountered;
 	gparam_list	plist;
 	ht_ent_mname	*tabent;
 	int		set_svn_index;
@@ -50,27 +49,8 @@ int ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *su
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
-	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
-					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
-					 * scenarios from not resetting this global variable even though this function returns.
-					 */
-	/* Verify entry conditions, make sure YDB CI environment is up etc. */
-	LIBYOTTADB_INIT(LYDB_RTN_SET, (int));		/* Note: macro could "return" from this function in case of errors */
-	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* previously unused entries should have been cleared by that
-							 * corresponding ydb_*_s() call.
-							 */
-	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
-	if (error_encountered)
-	{
-		assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* should have been cleared by "ydb_simpleapi_ch" */
-		REVERT;
-		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
-	}
-	/* Check if an outofband action that might care about has popped up */
-	if (outofband)
-		outofband_action(FALSE);
 	/* Do some validation */
-	VALIDATE_VARNAME(varname, subs_used, TRUE, LYDB_RTN_SET, -1, set_type, set_svn_index);
+	VALIDATE_VARNAME(varname, subs_used, TRUE, lydbrtn, -1, set_type, set_svn_index);
 	if (NULL == value)
 	{	/* Treat it as the null string */
 		null_ydb_buff.len_used = 0;
@@ -81,7 +61,7 @@ int ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *su
 	{
 		if (IS_INVALID_YDB_BUFF_T(value))
 			rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
-				      LEN_AND_LIT("Invalid value"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_SET)));
+				      LEN_AND_LIT("Invalid value"), LEN_AND_STR(LYDBRTNNAME(lydbrtn)));
 		CHECK_MAX_STR_LEN(value);		/* Generates error is value is too long */
 	}
 	/* Separate actions depending on the type of SET being done */
@@ -105,7 +85,7 @@ int ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *su
 				plist.arg[0] = lvvalp;				/* First arg is lv_val of the base var */
 				/* Setup plist (which would point to plist_mvals[] array) for callg invocation of op_putindx */
 				COPY_PARMS_TO_CALLG_BUFFER(subs_used, subsarray, plist, plist_mvals, TRUE, 1,
-											LYDBRTNNAME(LYDB_RTN_SET));
+											LYDBRTNNAME(lydbrtn));
 				dst_lv = (lv_val *)callg((callgfnptr)op_putindx, &plist);	/* Locate/create node */
 			}
 			SET_MVAL_FROM_YDB_BUFF_T(&dst_lv->v, value);	/* Set value into located/created node */
@@ -124,7 +104,7 @@ int ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *su
 			plist.arg[0] = &gvname;
 			/* Setup plist (which would point to plist_mvals[] array) for callg invocation of op_gvname */
 			COPY_PARMS_TO_CALLG_BUFFER(subs_used, subsarray, plist, plist_mvals, FALSE, 1,
-											LYDBRTNNAME(LYDB_RTN_SET));
+											LYDBRTNNAME(lydbrtn));
 			callg((callgfnptr)op_gvname, &plist);		/* Drive "op_gvname" to create key */
 			SET_MVAL_FROM_YDB_BUFF_T(&set_value, value);	/* Put value to set into mval for "op_gvput" */
 			INIT_MVAL_BEFORE_USE_IN_M_CODE(&set_value);	/* Do additional initialization of result mval as it could
@@ -145,6 +125,42 @@ int ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *su
 			assertpro(FALSE);
 	}
 	TREF(sapi_mstrs_for_gc_indx) = 0; /* mstrs in this array (added by RECORD_MSTR_FOR_GC) no longer need to be protected */
+}
+
+/* Routine to set local, global and ISV values
+ *
+ * Parameters:
+ *   varname	- Gives name of local, global or ISV variable
+ *   subs_used	- Count of subscripts (if any else 0)
+ *   subsarray  - an array of "subs_used" subscripts (not looked at if "subs_used" is 0)
+ *   value	- Value to be set into local/global/ISV
+ */
+int ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *value)
+{
+	boolean_t	error_encountered;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
+					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
+					 * scenarios from not resetting this global variable even though this function returns.
+					 */
+	/* Verify entry conditions, make sure YDB CI environment is up etc. */
+	LIBYOTTADB_INIT(LYDB_RTN_SET, (int));		/* Note: macro could "return" from this function in case of errors */
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* previously unused entries should have been cleared by that
+							 * corresponding ydb_*_s() call.
+							 */
+	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+	if (error_encountered)
+	{
+		assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* should have been cleared by "ydb_simpleapi_ch" */
+		REVERT;
+		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
+	}
+	/* Check if an outofband action that might care about has popped up */
+	if (outofband)
+		outofband_action(FALSE);
+	ydb_set_s_common(LYDB_RTN_SET, varname, subs_used, subsarray, value);
 	LIBYOTTADB_DONE;
 	REVERT;
 	return YDB_OK;
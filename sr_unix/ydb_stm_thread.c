@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -81,7 +81,7 @@ void *ydb_stm_thread(void *dummy_parm)
 	DCL_THREADGBL_ACCESS;
 
  	SETUP_THREADGBL_ACCESS;
-	/* Now that we are establishing this main work queue thread, we need to make sure all timers and checks done by
+	/* Now that we are establishing this STAPI signal thread, we need to make sure all timers and checks done by
 	 * YottaDB *and* user code deal with THIS thread and not some other random thread.
 	 */
 	assert(gtm_main_thread_id_set);